@@ -46,6 +46,22 @@
 // Object Tracker publish complete state MSG-ID
 #define OBJECT_TRACKER_COM_STATE_PUB		  0x1976
 
+// Object Tracker compact essentials state and name dictionary MSG-IDs
+#define OBJECT_TRACKER_ESS_COMPACT_PUB		  0x0974
+#define OBJECT_TRACKER_DICT_PUB		          0x0975
+
+// Object Tracker predicted track states MSG-ID (reply to OBJECT_TRACKER_PREDICT_CC)
+#define OBJECT_TRACKER_PREDICT_PUB		      0x0976
+
+// Object Tracker pipeline latency percentiles MSG-ID
+#define OBJECT_TRACKER_LATENCY_PUB		      0x0977
+
+// Object Tracker per-class and per-track statistics MSG-ID
+#define OBJECT_TRACKER_STATS_PUB		      0x0978
+
+// Object Tracker sliding-window aggregates MSG-ID
+#define OBJECT_TRACKER_WINDOW_PUB		      0x0979
+
 #endif /* _object_tracker_msgids_h_ */
 
 /************************/
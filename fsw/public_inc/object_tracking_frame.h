@@ -0,0 +1,84 @@
+/************************************************************************
+**
+**      GSC-18128-1, "Core Flight Executive Version 6.7"
+**
+**      Copyright (c) 2006-2019 United States Government as represented by
+**      the Administrator of the National Aeronautics and Space Administration.
+**      All Rights Reserved.
+**
+**      Licensed under the Apache License, Version 2.0 (the "License");
+**      you may not use this file except in compliance with the License.
+**      You may obtain a copy of the License at
+**
+**        http://www.apache.org/licenses/LICENSE-2.0
+**
+**      Unless required by applicable law or agreed to in writing, software
+**      distributed under the License is distributed on an "AS IS" BASIS,
+**      WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**      See the License for the specific language governing permissions and
+**      limitations under the License.
+**
+** File: object_tracking_frame.h
+**
+** Purpose:
+**  Binary detection frame shared between the ROS2 bridge and the Object
+**  Tracking app. One frame holds every YOLO detection from a single capture.
+**
+** Notes:
+**  This header is included by code built outside of cFS (the ROS2 bridge),
+**  so it only depends on <stdint.h>. All fields are host byte order.
+**
+*************************************************************************/
+#ifndef _object_tracking_frame_h_
+#define _object_tracking_frame_h_
+
+#include <stdint.h>
+
+// Maximum amount of detections carried by one frame
+#define OBJECT_FRAME_MAX_DETECTIONS           32
+
+// Matches the string lengths used in 'OBJECT_Essentials_Data_t'
+#define OBJECT_FRAME_NAME_LEN                 10
+
+// 3D keypoints per detection, matches 'keypoint_3D_listing' in 'rover_state'
+#define OBJECT_FRAME_KEYPOINTS                10
+
+// One YOLO detection - mirrors the fields of 'rover_state'
+typedef struct
+{
+    double      confidenceScore;
+    double      distance;
+    double      orientation;
+
+    // x, y, z of every keypoint, all zeros when YOLO didn't find it
+    float       keypoints[OBJECT_FRAME_KEYPOINTS][3];
+
+    uint8_t     class_id;
+    char        class_name[OBJECT_FRAME_NAME_LEN];
+    char        object_id[OBJECT_FRAME_NAME_LEN];
+    uint8_t     spare[3];
+} OBJECT_Frame_Detection_t;
+
+// Frame header, followed by 'detection_count' detections
+typedef struct
+{
+    // Capture timestamp of the YOLO image
+    uint32_t    timeStamp_sec;
+    uint32_t    timeStamp_nanoSec;
+
+    // Amount of valid entries in 'detections'
+    uint32_t    detection_count;
+    uint32_t    spare;
+
+    OBJECT_Frame_Detection_t detections[OBJECT_FRAME_MAX_DETECTIONS];
+} OBJECT_Frame_t;
+
+// Size of a frame holding 'count' detections, used for variable length transports
+#define OBJECT_FRAME_HDR_SIZE                 (sizeof(OBJECT_Frame_t) - sizeof(((OBJECT_Frame_t *)0)->detections))
+#define OBJECT_FRAME_SIZE(count)              (OBJECT_FRAME_HDR_SIZE + ((count) * sizeof(OBJECT_Frame_Detection_t)))
+
+#endif /* _object_tracking_frame_h_ */
+
+/************************/
+/*  End of File Comment */
+/************************/
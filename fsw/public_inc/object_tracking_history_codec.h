@@ -0,0 +1,92 @@
+/************************************************************************
+**
+**      GSC-18128-1, "Core Flight Executive Version 6.7"
+**
+**      Copyright (c) 2006-2019 United States Government as represented by
+**      the Administrator of the National Aeronautics and Space Administration.
+**      All Rights Reserved.
+**
+**      Licensed under the Apache License, Version 2.0 (the "License");
+**      you may not use this file except in compliance with the License.
+**      You may obtain a copy of the License at
+**
+**        http://www.apache.org/licenses/LICENSE-2.0
+**
+**      Unless required by applicable law or agreed to in writing, software
+**      distributed under the License is distributed on an "AS IS" BASIS,
+**      WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**      See the License for the specific language governing permissions and
+**      limitations under the License.
+**
+** File: object_tracking_history_codec.h
+**
+** Purpose:
+**  Delta/varint encoding of complete object histories. Shared by the
+**  Object Tracking app (encoder) and ground tools (decoder).
+**
+** Notes:
+**  Every packet decodes on its own. The first sample of a packet is the
+**  base sample, stored as unsigned varints:
+**    seconds, nanoseconds, track_id, class_id, confidence, distance_mm,
+**    orientation_cdeg
+**  Every following sample stores the zigzag varint difference to the
+**  previous one, in the same field order, except for the timestamp. It is
+**  stored as the change of the nanosecond interval between samples (zero
+**  for a steady frame rate, the first interval counts from zero).
+**  Orientation differences are taken the short way around the circle
+**  (-18000 to 17999).
+**
+**  Only depends on <stdint.h>/<stddef.h> so ground tools can build it.
+**
+*************************************************************************/
+#ifndef _object_tracking_history_codec_h_
+#define _object_tracking_history_codec_h_
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Complete history packet encodings
+#define OBJECT_HISTORY_ENCODING_RAW           0  /* Array of 'OBJECT_Essentials_Data_t' */
+#define OBJECT_HISTORY_ENCODING_DELTA         1  /* Base sample + varint deltas */
+
+// Largest encoding of one sample (7 fields, 10 bytes per 64 bit varint)
+#define OBJECT_HISTORY_MAX_SAMPLE_SIZE        70
+
+// One history sample in fixed point, same units as 'OBJECT_Compact_Object_t'
+typedef struct
+{
+    uint32_t    timeStamp_sec;
+    uint32_t    timeStamp_nanoSec;
+    uint32_t    distance_mm;
+    uint16_t    track_id;
+    uint16_t    orientation_cdeg;
+    uint8_t     class_id;
+    uint8_t     confidence;
+    uint8_t     spare[2];
+} OBJECT_History_Sample_t;
+
+// Encoder state for one packet
+typedef struct
+{
+    uint8_t                 *buffer;
+    size_t                  size;
+    size_t                  length;
+    uint32_t                sample_count;
+    OBJECT_History_Sample_t previous;
+    int64_t                 interval;
+} OBJECT_History_Encoder_t;
+
+void   OBJECT_History_Encoder_Init(OBJECT_History_Encoder_t *encoder, uint8_t *buffer, size_t size);
+
+// Returns 0 when the sample doesn't fit, the packet must then be sent and a new one started
+int    OBJECT_History_Encode(OBJECT_History_Encoder_t *encoder, const OBJECT_History_Sample_t *sample);
+
+// Decodes up to 'max_samples', returns the amount decoded or -1 if the data is malformed
+int32_t OBJECT_History_Decode(const uint8_t *buffer, size_t length,
+                              OBJECT_History_Sample_t *samples, uint32_t max_samples);
+
+#endif /* _object_tracking_history_codec_h_ */
+
+/************************/
+/*  End of File Comment */
+/************************/
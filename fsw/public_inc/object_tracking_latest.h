@@ -0,0 +1,118 @@
+/************************************************************************
+**
+**      GSC-18128-1, "Core Flight Executive Version 6.7"
+**
+**      Copyright (c) 2006-2019 United States Government as represented by
+**      the Administrator of the National Aeronautics and Space Administration.
+**      All Rights Reserved.
+**
+**      Licensed under the Apache License, Version 2.0 (the "License");
+**      you may not use this file except in compliance with the License.
+**      You may obtain a copy of the License at
+**
+**        http://www.apache.org/licenses/LICENSE-2.0
+**
+**      Unless required by applicable law or agreed to in writing, software
+**      distributed under the License is distributed on an "AS IS" BASIS,
+**      WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**      See the License for the specific language governing permissions and
+**      limitations under the License.
+**
+** File: object_tracking_latest.h
+**
+** Purpose:
+**  Layout of the latest-state table: the newest essentials of every track,
+**  which local apps read in place instead of subscribing to the bus.
+**
+** Notes:
+**  The table is the dump-only cFE table OBJECT_LATEST_TABLE_NAME, its
+**  address is the tracker's own memory. Readers get it once with
+**  'CFE_TBL_Share' and 'CFE_TBL_GetAddress' and never take a table lock.
+**
+**  Single writer, once per tracker cycle, into the buffer readers are not
+**  told about:
+**    1. b = 1 - table.latest
+**    2. buffers[b].sequence += 1        (odd - buffer is being written)
+**    3. write buffers[b]
+**    4. buffers[b].sequence += 1        (release - even again)
+**    5. table.latest = b                (release)
+**
+**  Reader:
+**    1. b  = table.latest               (acquire)
+**    2. s1 = buffers[b].sequence        (acquire), retry while odd
+**    3. use buffers[b] in place
+**    4. s2 = buffers[b].sequence        (after an acquire fence), the
+**       buffer was consistent when s2 == s1, otherwise retry
+**
+**  A buffer is only rewritten every second cycle, so a reader finishing
+**  within a cycle of step 1 never retries.
+**
+*************************************************************************/
+#ifndef _object_tracking_latest_h_
+#define _object_tracking_latest_h_
+
+#include <stdint.h>
+
+// cFE table name, 'CFE_TBL_Share' takes it as "OBJECT_TRACKER.LatestState"
+#define OBJECT_LATEST_TABLE_NAME              "LatestState"
+
+// One entry per possible track id
+#define OBJECT_LATEST_MAX_TRACKS              128
+
+// Newest detection of one track
+typedef struct
+{
+    uint32_t    timeStamp_sec;
+    uint32_t    timeStamp_nanoSec;
+    uint16_t    track_id;
+    uint8_t     class_id;
+
+    // Tracker lifecycle state of the track (OBJECT_TRACK_*)
+    uint8_t     lifecycle_state;
+
+    float       confidence;
+    float       distance;
+    float       orientation;
+
+    // Set when 'range_rate' and 'bearing_rate' hold an estimate
+    uint8_t     kinematics_valid;
+    uint8_t     spare[3];
+    float       range_rate;
+    float       bearing_rate;
+} OBJECT_Latest_Entry_t;
+
+typedef struct
+{
+    // Seqlock value, odd while the buffer is being written
+    volatile uint32_t       sequence;
+
+    // Tracker cycle the buffer was written in
+    uint32_t                cycle;
+
+    // 'entries' in use, ordered by track id
+    uint32_t                track_count;
+    uint32_t                spare;
+
+    OBJECT_Latest_Entry_t   entries[OBJECT_LATEST_MAX_TRACKS];
+} OBJECT_Latest_Buffer_t;
+
+typedef struct
+{
+    // Index of the buffer readers use
+    volatile uint32_t       latest;
+    uint32_t                spare;
+
+    OBJECT_Latest_Buffer_t  buffers[2];
+} OBJECT_Latest_Table_t;
+
+// Memory ordering helpers shared by the writer and the readers
+#define OBJECT_LATEST_LOAD_ACQUIRE(ptr)       __atomic_load_n((ptr), __ATOMIC_ACQUIRE)
+#define OBJECT_LATEST_STORE_RELEASE(ptr, val) __atomic_store_n((ptr), (val), __ATOMIC_RELEASE)
+#define OBJECT_LATEST_FENCE_ACQUIRE()         __atomic_thread_fence(__ATOMIC_ACQUIRE)
+#define OBJECT_LATEST_FENCE_RELEASE()         __atomic_thread_fence(__ATOMIC_RELEASE)
+
+#endif /* _object_tracking_latest_h_ */
+
+/************************/
+/*  End of File Comment */
+/************************/
@@ -0,0 +1,114 @@
+/************************************************************************
+**
+**      GSC-18128-1, "Core Flight Executive Version 6.7"
+**
+**      Copyright (c) 2006-2019 United States Government as represented by
+**      the Administrator of the National Aeronautics and Space Administration.
+**      All Rights Reserved.
+**
+**      Licensed under the Apache License, Version 2.0 (the "License");
+**      you may not use this file except in compliance with the License.
+**      You may obtain a copy of the License at
+**
+**        http://www.apache.org/licenses/LICENSE-2.0
+**
+**      Unless required by applicable law or agreed to in writing, software
+**      distributed under the License is distributed on an "AS IS" BASIS,
+**      WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**      See the License for the specific language governing permissions and
+**      limitations under the License.
+**
+** File: object_tracking_shm_ring.h
+**
+** Purpose:
+**  Layout of the POSIX shared-memory ring the ROS2 bridge writes detection
+**  frames into. The Object Tracking app reads the frames in place.
+**
+** Notes:
+**  Single writer, single reader. Frame N is stored in slot (N % SLOTS).
+**
+**  Writer, for frame N:
+**    1. slot.sequence = 2N + 1          (slot is being written)
+**    2. write slot.frame
+**    3. slot.sequence = 2N + 2          (release - frame N committed)
+**    4. ring.head     = N + 1           (release)
+**
+**  Reader, expecting frame N:
+**    1. head = ring.head                (acquire) - nothing to do if N >= head
+**    2. if head - N > SLOTS the writer lapped the reader (overrun),
+**       frames [N, head - SLOTS) are lost and N jumps to head - SLOTS
+**    3. s1 = slot.sequence, must equal 2N + 2
+**    4. consume slot.frame
+**    5. s2 = slot.sequence, must still equal s1 or the slot was reused
+**       while reading (overrun)
+**
+**  A writer restart re-initializes the header with a new 'generation',
+**  which makes the reader resynchronize to the new head.
+**
+*************************************************************************/
+#ifndef _object_tracking_shm_ring_h_
+#define _object_tracking_shm_ring_h_
+
+#include <stdint.h>
+
+#include "object_tracking_frame.h"
+
+// POSIX shared memory object name ('shm_open')
+#define OBJECT_SHM_RING_NAME                  "/object_tracking_ring"
+
+#define OBJECT_SHM_RING_MAGIC                 0x4F425452  /* 'OBTR' */
+#define OBJECT_SHM_RING_VERSION               2
+
+// Amount of frame slots in the ring, must be a power of two
+#define OBJECT_SHM_RING_SLOTS                 64
+#define OBJECT_SHM_RING_MASK                  (OBJECT_SHM_RING_SLOTS - 1)
+
+// Slot sequence values for frame 'seq'
+#define OBJECT_SHM_SLOT_WRITING(seq)          (((uint64_t)(seq) * 2) + 1)
+#define OBJECT_SHM_SLOT_COMMITTED(seq)        (((uint64_t)(seq) * 2) + 2)
+
+// One frame slot
+typedef struct
+{
+    // Seqlock value, see 'OBJECT_SHM_SLOT_WRITING'/'OBJECT_SHM_SLOT_COMMITTED'
+    volatile uint64_t   sequence;
+
+    OBJECT_Frame_t      frame;
+} OBJECT_ShmSlot_t;
+
+// Ring header - the slots follow on the next cache line
+typedef struct
+{
+    uint32_t            magic;
+    uint16_t            version;
+    uint16_t            slot_count;
+    uint32_t            slot_size;
+
+    // Incremented every time the writer (re)creates the ring
+    volatile uint32_t   generation;
+
+    // Sequence number of the next frame the writer will publish
+    volatile uint64_t   head;
+
+    uint8_t             spare[40];
+} OBJECT_ShmRingHdr_t;
+
+typedef struct
+{
+    OBJECT_ShmRingHdr_t header;
+    OBJECT_ShmSlot_t    slots[OBJECT_SHM_RING_SLOTS];
+} OBJECT_ShmRing_t;
+
+// Total size of the shared memory object
+#define OBJECT_SHM_RING_SIZE                  (sizeof(OBJECT_ShmRing_t))
+
+// Memory ordering helpers shared by the writer and the reader
+#define OBJECT_SHM_LOAD_ACQUIRE(ptr)          __atomic_load_n((ptr), __ATOMIC_ACQUIRE)
+#define OBJECT_SHM_STORE_RELEASE(ptr, val)    __atomic_store_n((ptr), (val), __ATOMIC_RELEASE)
+#define OBJECT_SHM_FENCE_ACQUIRE()            __atomic_thread_fence(__ATOMIC_ACQUIRE)
+
+#endif /* _object_tracking_shm_ring_h_ */
+
+/************************/
+/*  End of File Comment */
+/************************/
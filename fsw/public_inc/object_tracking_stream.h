@@ -0,0 +1,61 @@
+/************************************************************************
+**
+**      GSC-18128-1, "Core Flight Executive Version 6.7"
+**
+**      Copyright (c) 2006-2019 United States Government as represented by
+**      the Administrator of the National Aeronautics and Space Administration.
+**      All Rights Reserved.
+**
+**      Licensed under the Apache License, Version 2.0 (the "License");
+**      you may not use this file except in compliance with the License.
+**      You may obtain a copy of the License at
+**
+**        http://www.apache.org/licenses/LICENSE-2.0
+**
+**      Unless required by applicable law or agreed to in writing, software
+**      distributed under the License is distributed on an "AS IS" BASIS,
+**      WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**      See the License for the specific language governing permissions and
+**      limitations under the License.
+**
+**
+** File: object_tracking_stream.h
+**
+** Purpose:
+**  Record layout of the append-only detection stream file the ROS2 bridge
+**  writes and the Object Tracking app tails.
+**
+** Notes:
+**  The stream is a sequence of records, each one an 'OBJECT_Stream_Record_t'
+**  followed by 'length' bytes of 'OBJECT_Frame_t' (OBJECT_FRAME_SIZE of its
+**  detection count). Records are only ever appended. The bridge rotates the
+**  stream by renaming it and creating a new file, or truncates it in place;
+**  the reader detects both and starts over at offset 0.
+**
+*************************************************************************/
+#ifndef _object_tracking_stream_h_
+#define _object_tracking_stream_h_
+
+#include <stdint.h>
+
+#include "object_tracking_frame.h"
+
+// Stream file and the file the reader keeps its position in
+#define OBJECT_STREAM_PATH                    "/root/img_data/detections.stream"
+#define OBJECT_STREAM_OFFSET_PATH             "/root/img_data/detections.stream.offset"
+
+#define OBJECT_STREAM_RECORD_MAGIC            0x4F425352  /* 'OBSR' */
+
+typedef struct
+{
+    uint32_t    magic;
+
+    // Bytes of frame following this header
+    uint32_t    length;
+} OBJECT_Stream_Record_t;
+
+#endif /* _object_tracking_stream_h_ */
+
+/************************/
+/*  End of File Comment */
+/************************/
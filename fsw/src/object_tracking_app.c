@@ -71,21 +71,61 @@ void OBJECT_TrackerMain( void )
         // Pulls the newest data from ROS-Msg files and saves it to CMD struct 
         OBJECT_Save_States();
 
+        // Shards finish their queued detections, expire tracks that went quiet
+        // and prepare their unpublished samples. Idle from here to the next cycle.
+        OBJECT_Shard_Cycle(&OBJECT_TrackerData.Shards);
+
         // Publishes the newest enabled objects to the software bus 
         OBJECT_Publish_States();
 
+        // Newest state of every track for local apps, and table dump requests
+        OBJECT_Latest_Publish(&OBJECT_TrackerData.Latest, &OBJECT_TrackerData.Lifecycle,
+                              &OBJECT_TrackerData.Kinematics);
+        CFE_TBL_Manage(OBJECT_TrackerData.Latest.handle);
+
+        // Low-rate latency percentiles and SLA check
+        OBJECT_Latency_Report(&OBJECT_TrackerData.Latency);
+
+        // Low-rate per-class and per-track statistics
+        OBJECT_Stats_Report(&OBJECT_TrackerData.Stats, OBJECT_Latency_Now());
+
+        // Sliding-window aggregates, when enabled with OBJECT_TRACKER_WINDOW_CONFIG_CC
+        if(OBJECT_TrackerData.Window.publish){
+            OBJECT_Window_Publish(&OBJECT_TrackerData.Window, OBJECT_PREDICT_ALL_CLASSES, 0);
+        }
+
+        // Control commands and HK first, all of them, so bulk requests never hold them up.
+        // The wait paces the loop unless bulk requests are still queued.
         status = CFE_SB_RcvMsg(&OBJECT_TrackerData.MsgPtr,
                                OBJECT_TrackerData.CommandPipe,
-                               500);
+                               (OBJECT_TrackerData.BulkQueue.count > 0) ? CFE_SB_POLL : 500);
 
-
-        if (status == CFE_SUCCESS)
+        while (status == CFE_SUCCESS)
         {
             OBJECT_ProcessCommandPacket(OBJECT_TrackerData.MsgPtr);
+
+            status = CFE_SB_RcvMsg(&OBJECT_TrackerData.MsgPtr,
+                                   OBJECT_TrackerData.CommandPipe,
+                                   CFE_SB_POLL);
         }
 
+        // App history requests join the ground ones queued above
+        while (CFE_SB_RcvMsg(&OBJECT_TrackerData.MsgPtr,
+                             OBJECT_TrackerData.BulkPipe,
+                             CFE_SB_POLL) == CFE_SUCCESS)
+        {
+            OBJECT_ProcessBulkPacket(OBJECT_TrackerData.MsgPtr);
+        }
+
+        OBJECT_Serve_Bulk();
+
     }
 
+    // Releases the ingest transport
+    OBJECT_Shm_Detach(&OBJECT_TrackerData.ShmReader);
+    OBJECT_Socket_Close(&OBJECT_TrackerData.SocketReader);
+    OBJECT_Stream_Close(&OBJECT_TrackerData.StreamReader);
+
     CFE_ES_ExitApp(OBJECT_TrackerData.RunStatus);
 
 } /* End of OBJECT_TrackerMain() */
@@ -99,6 +139,7 @@ int32 OBJECT_TrackerInit( void )
 {
 
     int32    status;
+    int      itr;
 
     OBJECT_TrackerData.RunStatus = CFE_ES_RunStatus_APP_RUN;
 
@@ -111,6 +152,19 @@ int32 OBJECT_TrackerInit( void )
     // File counter
     OBJECT_TrackerData.fileItr = 0;
 
+    // Ingest transport
+    OBJECT_TrackerData.IngestMode = OBJECT_INGEST_MODE;
+    OBJECT_TrackerData.IngestFrameCount = 0;
+    OBJECT_TrackerData.IngestOverrunCount = 0;
+    OBJECT_TrackerData.IngestMalformedCount = 0;
+    memset(&OBJECT_TrackerData.ShmReader, 0, sizeof(OBJECT_TrackerData.ShmReader));
+    OBJECT_TrackerData.ShmReader.fd = -1;
+    OBJECT_TrackerData.SocketReader.fd = -1;
+    OBJECT_TrackerData.SocketReader.error_count = 0;
+    memset(&OBJECT_TrackerData.StreamReader, 0, sizeof(OBJECT_TrackerData.StreamReader));
+    OBJECT_TrackerData.StreamReader.fd = -1;
+    OBJECT_TrackerData.StreamReader.position_fd = -1;
+
     /*
     ** Initialize app configuration data
     */
@@ -143,11 +197,94 @@ int32 OBJECT_TrackerInit( void )
                     true);   
 
     // Used for outbound complete object state messages
-    CFE_SB_InitMsg(&OBJECT_TrackerData.object_complete_state_msg.MsgHdr,
-                    OBJECT_TRACKER_COM_STATE_MID,
+    CFE_SB_InitMsg(&OBJECT_TrackerData.object_complete_state_msg,
+                    OBJECT_TRACKER_COM_STATE_PUB,
                     sizeof(OBJECT_TrackerData.object_complete_state_msg),
                     true);   
 
+    // Used for outbound compact essentials and dictionary messages
+    OBJECT_Compact_Init(&OBJECT_TrackerData.Compact, OBJECT_SHARD_PARTITIONS);
+    OBJECT_Sched_Init(&OBJECT_TrackerData.Sched);
+    OBJECT_Filter_Init(&OBJECT_TrackerData.Filter);
+    OBJECT_Fuse_Init(&OBJECT_TrackerData.Fuse);
+    OBJECT_Bulk_Init(&OBJECT_TrackerData.BulkQueue);
+
+    // Used for outbound latency percentiles
+    OBJECT_Latency_Init(&OBJECT_TrackerData.Latency);
+    memset(&OBJECT_TrackerData.IngestTrace, 0, sizeof(OBJECT_TrackerData.IngestTrace));
+
+    // Used for outbound track prediction replies
+    OBJECT_TrackerData.EssIncludePrediction = false;
+    CFE_SB_InitMsg(&OBJECT_TrackerData.prediction_msg,
+                    OBJECT_TRACKER_PREDICT_PUB,
+                    sizeof(OBJECT_TrackerData.prediction_msg),
+                    true);
+
+    // Keypoint side buffers
+    OBJECT_TrackerData.EssIncludePose = false;
+    memset(&OBJECT_TrackerData.Keypoints, 0, sizeof(OBJECT_TrackerData.Keypoints));
+    memset(&OBJECT_TrackerData.Kinematics, 0, sizeof(OBJECT_TrackerData.Kinematics));
+    OBJECT_Stats_Init(&OBJECT_TrackerData.Stats);
+    OBJECT_Window_Init(&OBJECT_TrackerData.Window);
+
+    // History storage and track aging
+    memset(&OBJECT_TrackerData.object_track_listing, 0, sizeof(OBJECT_TrackerData.object_track_listing));
+    OBJECT_Lifecycle_Init(&OBJECT_TrackerData.Lifecycle, OBJECT_SHARD_PARTITIONS);
+    for(itr = 0; itr < MAX_OBJECT_TRACKING; itr++){
+        OBJECT_TrackerData.object_track_listing.object_list[itr].class_id = itr;
+        OBJECT_TrackerData.object_track_listing.object_list[itr].priority = OBJECT_CLASS_PRIORITY_DEFAULT;
+    }
+
+    // Shard tasks track their classes, each with its own sample pool and snapshot domain
+    status = OBJECT_Shard_Init(&OBJECT_TrackerData.Shards, OBJECT_TrackerData.SampleNodes);
+    if (status != CFE_SUCCESS)
+    {
+        CFE_ES_WriteToSysLog("Talker App: Error starting shard tasks, RC = 0x%08lX\n",
+                             (unsigned long)status);
+        return ( status );
+    }
+
+    // Parse workers only serve file ingest
+    status = OBJECT_Parse_Init(&OBJECT_TrackerData.ParsePool,
+                               (OBJECT_TrackerData.IngestMode == OBJECT_INGEST_FILE) ? OBJECT_PARSE_WORKERS : 0,
+                               OBJECT_TrackerData.fileItr);
+    if (status != CFE_SUCCESS)
+    {
+        CFE_ES_WriteToSysLog("Talker App: Error starting parse workers, RC = 0x%08lX\n",
+                             (unsigned long)status);
+        return ( status );
+    }
+
+    // Only file ingest leaves processed files behind
+    if (OBJECT_TrackerData.IngestMode == OBJECT_INGEST_FILE)
+    {
+        status = OBJECT_Retire_Init(&OBJECT_TrackerData.Retire, OBJECT_TrackerData.fileItr);
+        if (status != CFE_SUCCESS)
+        {
+            CFE_ES_WriteToSysLog("Talker App: Error starting file retirement, RC = 0x%08lX\n",
+                                 (unsigned long)status);
+            return ( status );
+        }
+    }
+
+    // Latest-state table, read in place by local apps
+    status = OBJECT_Latest_Init(&OBJECT_TrackerData.Latest);
+    if (status != CFE_SUCCESS)
+    {
+        CFE_ES_WriteToSysLog("Talker App: Error registering latest-state table, RC = 0x%08lX\n",
+                             (unsigned long)status);
+        return ( status );
+    }
+
+    // History exports are written on their own task
+    status = OBJECT_Export_Init(&OBJECT_TrackerData.Export);
+    if (status != CFE_SUCCESS)
+    {
+        CFE_ES_WriteToSysLog("Talker App: Error starting history export, RC = 0x%08lX\n",
+                             (unsigned long)status);
+        return ( status );
+    }
+
     /*
     ** Create Software Bus message pipe.
     */
@@ -197,7 +334,27 @@ int32 OBJECT_TrackerInit( void )
         return ( status );
     }
 
+    // Bulk requests have their own pipe so a burst can't fill the command pipe
+    status = CFE_SB_CreatePipe(&OBJECT_TrackerData.BulkPipe,
+                               OBJECT_BULK_PIPE_DEPTH,
+                               "OBJECT_BULK_PIPE");
+    if (status != CFE_SUCCESS)
+    {
+        CFE_ES_WriteToSysLog("Talker App: Error creating bulk pipe, RC = 0x%08lX\n",
+                             (unsigned long)status);
+        return ( status );
+    }
+
+    // Subscribing to app requests for complete object histories
+    status = CFE_SB_Subscribe(OBJECT_TRACKER_COM_STATE_REQ,
+        OBJECT_TrackerData.BulkPipe);
+    if (status != CFE_SUCCESS )
+    {
+        CFE_ES_WriteToSysLog("Talker App: Error Subscribing to Complete History Requests, RC = 0x%08lX\n",
+            (unsigned long)status);
 
+        return ( status );
+    }
 
     CFE_EVS_SendEvent (OBJECT_STARTUP_INF_EID,
                        CFE_EVS_EventType_INFORMATION,
@@ -241,12 +398,6 @@ void OBJECT_ProcessCommandPacket( CFE_SB_MsgPtr_t Msg )
             OBJECT_Switch_Request((OBJECT_Switch_t *) Msg->payload);
             break; 
 
-        // Allows ground GCS to change publish mode for each tracked object
-        case OBJECT_TRACKER_COMPLETE_CC:
-            // Passing uniform message payload (same payload for ground (GCS) and app commands/messages)
-            OBJECT_Publish_Complete_State((OBJECT_Switch_COM_App_t *) Msg);
-            break;
-
         default:
             CFE_EVS_SendEvent(OBJECT_INVALID_MSGID_ERR_EID,
                             CFE_EVS_EventType_ERROR,
@@ -259,6 +410,114 @@ void OBJECT_ProcessCommandPacket( CFE_SB_MsgPtr_t Msg )
 
 } /* End OBJECT_ProcessCommandPacket */
 
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  OBJECT_ProcessBulkPacket                                           */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         This routine will queue any packet that is received on the OBJECT  */
+/*         bulk pipe.                                                         */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * *  * *  * * * * */
+void OBJECT_ProcessBulkPacket( CFE_SB_MsgPtr_t Msg )
+{
+    OBJECT_Bulk_Request_t request;
+    CFE_SB_MsgId_t  MsgId;
+
+    MsgId = CFE_SB_GetMsgId(Msg);
+    memset(&request, 0, sizeof(request));
+
+    switch (MsgId)
+    {
+        // Allows other apps to request the complete history of a tracked object
+        case OBJECT_TRACKER_COM_STATE_REQ:
+            if (OBJECT_VerifyCmdLength(Msg, sizeof(OBJECT_Switch_COM_App_t)))
+            {
+                request.kind = OBJECT_BULK_COMPLETE;
+                request.class_id = ((OBJECT_Switch_COM_App_t *) Msg)->class_id;
+                request.encoding = ((OBJECT_Switch_COM_App_t *) Msg)->encoding;
+                OBJECT_Queue_Bulk(&request);
+            }
+            break;
+
+        default:
+            CFE_EVS_SendEvent(OBJECT_INVALID_MSGID_ERR_EID,
+                            CFE_EVS_EventType_ERROR,
+                            "TALKER: invalid bulk packet,MID = 0x%x",
+                            MsgId);
+            break;
+    }
+
+    return;
+
+} /* End OBJECT_ProcessBulkPacket */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  OBJECT_Queue_Bulk                                                  */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Queues a bulk request, coalesced with an equal waiting one         */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * *  * *  * * * * */
+void OBJECT_Queue_Bulk(const OBJECT_Bulk_Request_t *request){
+
+    if(OBJECT_Bulk_Push(&OBJECT_TrackerData.BulkQueue, request) == OBJECT_BULK_FULL){
+        OBJECT_TrackerData.ErrCounter++;
+
+        CFE_EVS_SendEvent(OBJECT_BULK_ERR_EID,
+                          CFE_EVS_EventType_ERROR,
+                          "Bulk request queue full, request kind %d for class %d refused",
+                          request->kind, request->class_id);
+    }
+
+} /* End of OBJECT_Queue_Bulk */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  OBJECT_Serve_Bulk                                                  */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Answers queued bulk requests, oldest first, until the cycle        */
+/*         budget is spent                                                    */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * *  * *  * * * * */
+void OBJECT_Serve_Bulk(void){
+    OBJECT_Bulk_Request_t request;
+    OBJECT_Predict_t predict;
+    OBJECT_Window_Query_t query;
+    uint64 start = OBJECT_Latency_Now();
+
+    do {
+        if(!OBJECT_Bulk_Pop(&OBJECT_TrackerData.BulkQueue, &request)){
+            return;
+        }
+
+        switch(request.kind){
+            case OBJECT_BULK_COMPLETE:
+                OBJECT_Publish_Complete_State(request.class_id, request.encoding,
+                                              request.since_sequence, request.if_version);
+                break;
+
+            case OBJECT_BULK_PREDICT:
+                memset(&predict, 0, sizeof(predict));
+                predict.seconds = request.seconds;
+                predict.subseconds = request.subseconds;
+                predict.class_id = request.class_id;
+                OBJECT_Predict_Request(&predict);
+                break;
+
+            case OBJECT_BULK_WINDOW:
+                memset(&query, 0, sizeof(query));
+                query.class_id = request.class_id;
+                query.track_id = request.track_id;
+                OBJECT_Window_Query_Request(&query);
+                break;
+
+            default:
+                break;
+        }
+    } while((OBJECT_Latency_Now() - start) < OBJECT_BULK_BUDGET_US);
+
+} /* End of OBJECT_Serve_Bulk */
+
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
 /*                                                                            */
 /* OBJECT_ProcessGroundCommand() -- TALKER ground commands                */
@@ -266,9 +525,11 @@ void OBJECT_ProcessCommandPacket( CFE_SB_MsgPtr_t Msg )
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
 void OBJECT_ProcessGroundCommand( CFE_SB_MsgPtr_t Msg )
 {
+    OBJECT_Bulk_Request_t request;
     uint16 CommandCode;
 
     CommandCode = CFE_SB_GetCmdCode(Msg);
+    memset(&request, 0, sizeof(request));
 
     /*
     ** Process "known" TALKER app ground commands
@@ -308,15 +569,126 @@ void OBJECT_ProcessGroundCommand( CFE_SB_MsgPtr_t Msg )
 
             break;   
 
-        case OBJECT_TRACKER_COM_STATE_REQ:
+        // Bulk requests are queued and answered after every control command
+        case OBJECT_TRACKER_COMPLETE_CC:
             if (OBJECT_VerifyCmdLength(Msg, sizeof(OBJECT_Switch_COM_GCS_t)))
             {
-                // Passing uniform message payload (same payload for ground (GCS) and app commands/messages)
-                OBJECT_Publish_Complete_State((OBJECT_Switch_COM_GCS_t *) Msg);
+                request.kind = OBJECT_BULK_COMPLETE;
+                request.class_id = ((OBJECT_Switch_COM_GCS_t *) Msg)->class_id;
+                request.encoding = ((OBJECT_Switch_COM_GCS_t *) Msg)->encoding;
+                OBJECT_Queue_Bulk(&request);
             } 
 
             break;
 
+        case OBJECT_TRACKER_HISTORY_SINCE_CC:
+            if (OBJECT_VerifyCmdLength(Msg, sizeof(OBJECT_History_Since_t)))
+            {
+                request.kind = OBJECT_BULK_COMPLETE;
+                request.class_id = ((OBJECT_History_Since_t *) Msg)->class_id;
+                request.encoding = ((OBJECT_History_Since_t *) Msg)->encoding;
+                request.since_sequence = ((OBJECT_History_Since_t *) Msg)->since_sequence;
+                request.if_version = ((OBJECT_History_Since_t *) Msg)->if_version;
+                OBJECT_Queue_Bulk(&request);
+            }
+
+            break;
+
+        case OBJECT_TRACKER_FORMAT_CC:
+            if (OBJECT_VerifyCmdLength(Msg, sizeof(OBJECT_Format_t)))
+            {
+                OBJECT_Format_Request((OBJECT_Format_t *) Msg);
+            }
+
+            break;
+
+        case OBJECT_TRACKER_PRIORITY_CC:
+            if (OBJECT_VerifyCmdLength(Msg, sizeof(OBJECT_Priority_t)))
+            {
+                OBJECT_Priority_Request((OBJECT_Priority_t *) Msg);
+            }
+
+            break;
+
+        case OBJECT_TRACKER_PREDICT_CC:
+            if (OBJECT_VerifyCmdLength(Msg, sizeof(OBJECT_Predict_t)))
+            {
+                request.kind = OBJECT_BULK_PREDICT;
+                request.class_id = ((OBJECT_Predict_t *) Msg)->class_id;
+                request.seconds = ((OBJECT_Predict_t *) Msg)->seconds;
+                request.subseconds = ((OBJECT_Predict_t *) Msg)->subseconds;
+                OBJECT_Queue_Bulk(&request);
+            }
+
+            break;
+
+        case OBJECT_TRACKER_LATENCY_SLA_CC:
+            if (OBJECT_VerifyCmdLength(Msg, sizeof(OBJECT_Latency_Sla_t)))
+            {
+                OBJECT_Latency_Sla_Request((OBJECT_Latency_Sla_t *) Msg);
+            }
+
+            break;
+
+        case OBJECT_TRACKER_WINDOW_QUERY_CC:
+            if (OBJECT_VerifyCmdLength(Msg, sizeof(OBJECT_Window_Query_t)))
+            {
+                request.kind = OBJECT_BULK_WINDOW;
+                request.class_id = ((OBJECT_Window_Query_t *) Msg)->class_id;
+                request.track_id = ((OBJECT_Window_Query_t *) Msg)->track_id;
+                OBJECT_Queue_Bulk(&request);
+            }
+
+            break;
+
+        case OBJECT_TRACKER_WINDOW_CONFIG_CC:
+            if (OBJECT_VerifyCmdLength(Msg, sizeof(OBJECT_Window_Config_t)))
+            {
+                OBJECT_Window_Config_Request((OBJECT_Window_Config_t *) Msg);
+            }
+
+            break;
+
+        case OBJECT_TRACKER_PUBLISH_RATE_CC:
+            if (OBJECT_VerifyCmdLength(Msg, sizeof(OBJECT_Publish_Rate_t)))
+            {
+                OBJECT_Publish_Rate_Request((OBJECT_Publish_Rate_t *) Msg);
+            }
+
+            break;
+
+        case OBJECT_TRACKER_PUBLISH_BUDGET_CC:
+            if (OBJECT_VerifyCmdLength(Msg, sizeof(OBJECT_Publish_Budget_t)))
+            {
+                OBJECT_Publish_Budget_Request((OBJECT_Publish_Budget_t *) Msg);
+            }
+
+            break;
+
+        case OBJECT_TRACKER_SUBSCRIBE_CC:
+            if (OBJECT_VerifyCmdLength(Msg, sizeof(OBJECT_Subscribe_t)))
+            {
+                OBJECT_Subscribe_Request((OBJECT_Subscribe_t *) Msg);
+            }
+
+            break;
+
+        case OBJECT_TRACKER_FUSE_CONFIG_CC:
+            if (OBJECT_VerifyCmdLength(Msg, sizeof(OBJECT_Fuse_Config_t)))
+            {
+                OBJECT_Fuse_Config_Request((OBJECT_Fuse_Config_t *) Msg);
+            }
+
+            break;
+
+        case OBJECT_TRACKER_EXPORT_CC:
+            if (OBJECT_VerifyCmdLength(Msg, sizeof(OBJECT_Export_History_t)))
+            {
+                OBJECT_Export_Request((OBJECT_Export_History_t *) Msg);
+            }
+
+            break;
+
         /* default case already found during FC vs length test */
         default:
             CFE_EVS_SendEvent(OBJECT_COMMAND_ERR_EID,
@@ -341,11 +713,59 @@ void OBJECT_ProcessGroundCommand( CFE_SB_MsgPtr_t Msg )
 /* * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * *  * *  * * * * */
 int32 OBJECT_ReportHousekeeping( const CCSDS_CommandPacket_t *Msg )
 {
+    const OBJECT_Lifecycle_Wheel_t *wheel;
+    const OBJECT_Shard_t *shard;
+    uint32 itr;
+
     /*
     ** Get command execution counters...
     */
     OBJECT_TrackerData.HkBuf.HkTlm.Payload.CommandErrorCounter = OBJECT_TrackerData.ErrCounter;
     OBJECT_TrackerData.HkBuf.HkTlm.Payload.CommandCounter = OBJECT_TrackerData.CmdCounter;
+    OBJECT_TrackerData.HkBuf.HkTlm.Payload.IngestFrameCount = OBJECT_TrackerData.IngestFrameCount;
+    OBJECT_TrackerData.HkBuf.HkTlm.Payload.IngestOverrunCount = OBJECT_TrackerData.IngestOverrunCount;
+    OBJECT_TrackerData.HkBuf.HkTlm.Payload.IngestMalformedCount = OBJECT_TrackerData.IngestMalformedCount;
+
+    // Track and sample counts are kept per shard
+    OBJECT_TrackerData.HkBuf.HkTlm.Payload.TrackTentativeCount = 0;
+    OBJECT_TrackerData.HkBuf.HkTlm.Payload.TrackConfirmedCount = 0;
+    OBJECT_TrackerData.HkBuf.HkTlm.Payload.TrackCoastingCount = 0;
+    OBJECT_TrackerData.HkBuf.HkTlm.Payload.TrackDeletedCount = 0;
+    for(itr = 0; itr < OBJECT_TrackerData.Lifecycle.wheel_count; itr++){
+        wheel = &OBJECT_TrackerData.Lifecycle.wheels[itr];
+        OBJECT_TrackerData.HkBuf.HkTlm.Payload.TrackTentativeCount += wheel->tentative_count;
+        OBJECT_TrackerData.HkBuf.HkTlm.Payload.TrackConfirmedCount += wheel->confirmed_count;
+        OBJECT_TrackerData.HkBuf.HkTlm.Payload.TrackCoastingCount += wheel->coasting_count;
+        OBJECT_TrackerData.HkBuf.HkTlm.Payload.TrackDeletedCount += wheel->deleted_count;
+    }
+
+    OBJECT_TrackerData.HkBuf.HkTlm.Payload.SamplePoolFreeCount = 0;
+    OBJECT_TrackerData.HkBuf.HkTlm.Payload.SamplePoolEmptyCount = 0;
+    OBJECT_TrackerData.HkBuf.HkTlm.Payload.SamplePoolReserveCount = 0;
+    OBJECT_TrackerData.HkBuf.HkTlm.Payload.SampleEvictedCount = 0;
+    for(itr = 0; itr < OBJECT_TrackerData.Shards.shard_count; itr++){
+        shard = &OBJECT_TrackerData.Shards.shards[itr];
+        OBJECT_TrackerData.HkBuf.HkTlm.Payload.SamplePoolFreeCount += shard->pool.free_count;
+        OBJECT_TrackerData.HkBuf.HkTlm.Payload.SamplePoolEmptyCount += shard->empty_count;
+        OBJECT_TrackerData.HkBuf.HkTlm.Payload.SamplePoolReserveCount += shard->pool.reserve_count;
+        OBJECT_TrackerData.HkBuf.HkTlm.Payload.SampleEvictedCount += shard->evicted_count;
+    }
+
+    for(itr = 0; itr < MAX_OBJECT_TRACKING; itr++){
+        OBJECT_TrackerData.HkBuf.HkTlm.Payload.ClassEvictedCount[itr] =
+            OBJECT_TrackerData.object_track_listing.object_list[itr].evicted_count;
+    }
+    OBJECT_TrackerData.HkBuf.HkTlm.Payload.PublishDeferredCount = OBJECT_TrackerData.Sched.deferred_count;
+    OBJECT_TrackerData.HkBuf.HkTlm.Payload.PublishDroppedCount = OBJECT_TrackerData.Sched.dropped_count;
+    OBJECT_TrackerData.HkBuf.HkTlm.Payload.FilteredSampleCount = OBJECT_TrackerData.Filter.filtered_count;
+    OBJECT_TrackerData.HkBuf.HkTlm.Payload.FusedDetectionCount = OBJECT_TrackerData.Fuse.fused_count;
+    OBJECT_TrackerData.HkBuf.HkTlm.Payload.BulkCoalescedCount = OBJECT_TrackerData.BulkQueue.coalesced_count;
+    OBJECT_TrackerData.HkBuf.HkTlm.Payload.BulkRejectedCount = OBJECT_TrackerData.BulkQueue.rejected_count;
+    OBJECT_TrackerData.HkBuf.HkTlm.Payload.ExportCount = OBJECT_TrackerData.Export.export_count;
+    OBJECT_TrackerData.HkBuf.HkTlm.Payload.ExportErrorCount = OBJECT_TrackerData.Export.error_count;
+    OBJECT_TrackerData.HkBuf.HkTlm.Payload.RetiredFileCount = OBJECT_TrackerData.Retire.retired_count;
+    OBJECT_TrackerData.HkBuf.HkTlm.Payload.RetireErrorCount = OBJECT_TrackerData.Retire.error_count;
+    OBJECT_TrackerData.HkBuf.HkTlm.Payload.RetiredBytesReclaimed = OBJECT_TrackerData.Retire.reclaimed_bytes;
 
     /*
     ** Send housekeeping telemetry packet...
@@ -389,9 +809,34 @@ int32 OBJECT_Noop( const OBJECT_Noop_t *Msg )
 /* * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * *  * *  * * * * */
 int32 OBJECT_ResetCounters( const OBJECT_ResetCounters_t *Msg )
 {
+    uint32 itr;
 
     OBJECT_TrackerData.CmdCounter = 0;
     OBJECT_TrackerData.ErrCounter = 0;
+    OBJECT_TrackerData.IngestFrameCount = 0;
+    OBJECT_TrackerData.IngestOverrunCount = 0;
+    OBJECT_TrackerData.IngestMalformedCount = 0;
+    for(itr = 0; itr < OBJECT_TrackerData.Lifecycle.wheel_count; itr++){
+        OBJECT_TrackerData.Lifecycle.wheels[itr].deleted_count = 0;
+    }
+    for(itr = 0; itr < OBJECT_TrackerData.Shards.shard_count; itr++){
+        OBJECT_TrackerData.Shards.shards[itr].empty_count = 0;
+        OBJECT_TrackerData.Shards.shards[itr].evicted_count = 0;
+    }
+    for(itr = 0; itr < MAX_OBJECT_TRACKING; itr++){
+        OBJECT_TrackerData.object_track_listing.object_list[itr].evicted_count = 0;
+    }
+    OBJECT_TrackerData.Sched.deferred_count = 0;
+    OBJECT_TrackerData.Sched.dropped_count = 0;
+    OBJECT_TrackerData.Filter.filtered_count = 0;
+    OBJECT_TrackerData.Fuse.fused_count = 0;
+    OBJECT_TrackerData.BulkQueue.coalesced_count = 0;
+    OBJECT_TrackerData.BulkQueue.rejected_count = 0;
+    OBJECT_TrackerData.Export.export_count = 0;
+    OBJECT_TrackerData.Export.error_count = 0;
+    OBJECT_TrackerData.Retire.retired_count = 0;
+    OBJECT_TrackerData.Retire.error_count = 0;
+    OBJECT_TrackerData.Retire.reclaimed_bytes = 0;
 
     CFE_EVS_SendEvent(OBJECT_COMMANDRST_INF_EID,
                       CFE_EVS_EventType_INFORMATION,
@@ -459,9 +904,49 @@ void OBJECT_Process(const OBJECT_Process_t *Msg){
 /* * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * *  * *  * * * * */
 // TO-DO: USE C BASED GENERICS AND MACROS TO SUPPORT MULTIPLE DATA/STRUCT TYPES
 void OBJECT_Save_States(){
+
+    // Pulls the pending frames from the selected transport
+    switch(OBJECT_TrackerData.IngestMode){
+        case OBJECT_INGEST_SHM_RING:
+            OBJECT_Shm_Ingest(&OBJECT_TrackerData.ShmReader);
+            break;
+
+        case OBJECT_INGEST_SOCKET:
+            OBJECT_Socket_Ingest(&OBJECT_TrackerData.SocketReader);
+            break;
+
+        case OBJECT_INGEST_STREAM:
+            OBJECT_Stream_Ingest(&OBJECT_TrackerData.StreamReader);
+            break;
+
+        case OBJECT_INGEST_FILE:
+        default:
+            OBJECT_File_Ingest();
+            break;
+    }
+
+} /* End of OBJECT_Save_States */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  OBJECT_File_Ingest                                                 */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Loads the next ROS2-JSON 'Output_N' file                           */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * *  * *  * * * * */
+void OBJECT_File_Ingest(){
+
+    // Backlogged files are parsed concurrently and committed in order
+    if(OBJECT_TrackerData.ParsePool.worker_count > 0){
+        OBJECT_Parse_Dispatch(&OBJECT_TrackerData.ParsePool);
+        OBJECT_Parse_Commit(&OBJECT_TrackerData.ParsePool);
+        OBJECT_Retire_Committed(&OBJECT_TrackerData.Retire, OBJECT_TrackerData.ParsePool.next_commit);
+        return;
+    }
+
     // TO-DO: Turn this into a GENERIC AND MARCO TO GENERALIZE ARRAY TYPE
     // Creates a rover array to hold entries from the YOLO-ROS JSON file
-    rover_array rovers;
+    rover_array *rovers = &OBJECT_TrackerData.IngestRovers;
 
     // TO-DO: Replace with a function that scans directory contents and processes all of them
     //        into linked-list. Or just take the most recent input.
@@ -470,7 +955,82 @@ void OBJECT_Save_States(){
     sprintf(fileLoc, "%sOutput_%d", ROS2_FILE_LOC, OBJECT_TrackerData.fileItr++);
 
     // Loads object array with data from JSON file 
-    sync_fusion_injest(&rovers, fileLoc);
+    OBJECT_TrackerData.IngestTrace.arrival_us = OBJECT_Latency_Now();
+    sync_fusion_injest(rovers, fileLoc);
+    OBJECT_TrackerData.IngestTrace.parsed_us = OBJECT_Latency_Now();
+
+    OBJECT_Commit_Rovers(rovers);
+    OBJECT_Retire_Committed(&OBJECT_TrackerData.Retire, OBJECT_TrackerData.fileItr);
+
+} /* End of OBJECT_File_Ingest */
+
+// Frames carry as many keypoints as 'rover_state' holds
+typedef char OBJECT_Frame_Keypoint_Check_t[(OBJECT_FRAME_KEYPOINTS == OBJECT_KEYPOINT_COUNT) ? 1 : -1];
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  OBJECT_Frame_To_Rovers                                             */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Decodes a binary bridge frame into a 'rover_array'                 */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * *  * *  * * * * */
+void OBJECT_Frame_To_Rovers(const OBJECT_Frame_t *frame, rover_array *rovers){
+    const OBJECT_Frame_Detection_t *detection;
+    rover_state *rover;
+    uint32 count = frame->detection_count;
+    uint32 itr;
+    uint32 kp;
+
+    // Clamps to whichever side holds fewer detections
+    if(count > OBJECT_FRAME_MAX_DETECTIONS){
+        count = OBJECT_FRAME_MAX_DETECTIONS;
+    }
+    if(count > (sizeof(rovers->rovers_array) / sizeof(rovers->rovers_array[0]))){
+        count = sizeof(rovers->rovers_array) / sizeof(rovers->rovers_array[0]);
+    }
+
+    rovers->timeStamp_sec = frame->timeStamp_sec;
+    rovers->timeStamp_nanoSec = frame->timeStamp_nanoSec;
+    rovers->arrayLen = count;
+
+    for(itr = 0; itr < count; itr++){
+        detection = &frame->detections[itr];
+        rover = &rovers->rovers_array[itr];
+
+        rover->timeStamp_sec = frame->timeStamp_sec;
+        rover->timeStamp_nanoSec = frame->timeStamp_nanoSec;
+        rover->class_id = detection->class_id;
+        rover->confidenceScore = detection->confidenceScore;
+        rover->distance = detection->distance;
+        rover->orientation = detection->orientation;
+
+        for(kp = 0; kp < OBJECT_KEYPOINT_COUNT; kp++){
+            rover->keypoint_3D_listing[kp].x = detection->keypoints[kp][0];
+            rover->keypoint_3D_listing[kp].y = detection->keypoints[kp][1];
+            rover->keypoint_3D_listing[kp].z = detection->keypoints[kp][2];
+        }
+
+        // Bridge strings are not guaranteed to be terminated
+        strncpy(rover->class_name, detection->class_name, sizeof(rover->class_name) - 1);
+        rover->class_name[sizeof(rover->class_name) - 1] = '\0';
+        strncpy(rover->object_id, detection->object_id, sizeof(rover->object_id) - 1);
+        rover->object_id[sizeof(rover->object_id) - 1] = '\0';
+    }
+
+} /* End of OBJECT_Frame_To_Rovers */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  OBJECT_Commit_Rovers                                               */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Common insertion path for every ingest transport. Hands the        */
+/*         frame's detections to the shards owning their classes.             */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * *  * *  * * * * */
+void OBJECT_Commit_Rovers(rover_array *rovers){
+
+    // Overlapping detections of one object become one sample before anything sees them
+    OBJECT_Fuse_Frame(&OBJECT_TrackerData.Fuse, rovers);
 
     // Checks if it's too large and cleans out the Linked list first with clean-up function.
     // Will save the data to software bus if flag (BACKUP_HISTORY) is true.
@@ -482,217 +1042,486 @@ void OBJECT_Save_States(){
         OBJECT_Publish_Complete_State_GEN();
     }
 
-    // Saves 'rover_array' elemets to local CMD structs
+    // Saves 'rover_array' elemets to local CMD structs, on the shards
+    // that own their classes (see OBJECT_Commit_Detections)
+    OBJECT_Shard_Route(&OBJECT_TrackerData.Shards, rovers, &OBJECT_TrackerData.IngestTrace);
+
+} /* End of OBJECT_Commit_Rovers */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  OBJECT_Commit_Detections                                           */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Tracks and stores the detections of one frame that belong to a     */
+/*         shard's classes. Runs on that shard, every table it changes is     */
+/*         kept per track or per class.                                       */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * *  * *  * * * * */
+void OBJECT_Commit_Detections(OBJECT_Shard_t *shard, const OBJECT_Shard_Entry_t *const *entries, int count){
+    const rover_state *states[OBJECT_SHARD_QUEUE_DEPTH];
+    uint16 track_id;
+    uint64 now;
+    int itr;
+
+    for(itr = 0; itr < count; itr++){
+        states[itr] = &entries[itr]->state;
+    }
+
+    // Range rate, bearing rate, velocity and contact time for the whole batch
+    OBJECT_Kinematics_Update(&OBJECT_TrackerData.Kinematics, &OBJECT_TrackerData.Compact, states, count);
+
+    // Track ids were assigned by the kinematics pass
+    now = OBJECT_Latency_Now();
+    for(itr = 0; itr < count; itr++){
+        track_id = OBJECT_Dict_Lookup(&OBJECT_TrackerData.Compact, states[itr]);
+
+        // Keypoints go to the track's side buffer, geometry is computed once here
+        OBJECT_Keypoints_Store(&OBJECT_TrackerData.Keypoints, track_id, states[itr]);
+        OBJECT_Stats_Update(&OBJECT_TrackerData.Stats, track_id, states[itr], now);
+        OBJECT_Window_Update(&OBJECT_TrackerData.Window, track_id, states[itr]);
+        OBJECT_Latest_Update(&OBJECT_TrackerData.Latest, track_id, states[itr]);
+    }
+
     // Inserts the elements in order based on time stamps (sec and nano sec)
-    amortizedInsert(rover_array *rovers);
+    amortizedInsert(shard, entries, count);
 
-} /* End of OBJECT_Save_States */
+} /* End of OBJECT_Commit_Detections */
 
 // TO-DO: USE C BASED GENERICS AND MACROS TO SUPPORT MULTIPLE DATA/STRUCT TYPES
-// TO-DO: BREAK APART INTO MULTIPLE SUB-FUNCTIONS - TOO LONG
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  OBJECT_State_Before                                                */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         True when sample A was taken before sample B                       */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * *  * *  * * * * */
+static bool OBJECT_State_Before(const rover_state *a, const rover_state *b){
+
+    if(a->timeStamp_sec != b->timeStamp_sec){
+        return(a->timeStamp_sec < b->timeStamp_sec);
+    }
+
+    return(a->timeStamp_nanoSec < b->timeStamp_nanoSec);
+
+} /* End of OBJECT_State_Before */
 
 // Since most new entries (theoretically) should be latest and will
 // be added to the end of the linked-list (O(1)). Some entries may have
 // been delayed, meaning it will require a linear search and insertion (O(n)).
 // Making this an amortized linked list insert.
-int32 amortizedInsert(rover_array *rovers){
-    rover_state travelerNode;
+int32 amortizedInsert(OBJECT_Shard_t *shard, const OBJECT_Shard_Entry_t *const *entries, int count){
     Object_Master_Node_t *headNode;
+    Object_Node_t *newObject;
+    const rover_state *state;
+    uint32 now = OBJECT_Lifecycle_Now();
+    int32 inserted = 0;
+    int itr;
 
-    // Array timestamps for the YOLO capture
-    uint32 time_sec = rovers->timeStamp_sec;
-    uint32 time_nanoSec = rovers->timeStamp_nanoSec;
+    for(itr = 0; itr < count; itr++){
+        state = &entries[itr]->state;
 
-    // Used for tracking each elements time for sorting
-    uint32 local_time_sec;
-    uint32 local_time_nanoSec;
+        // The class-id dictates the array index position
+        if(state->class_id >= MAX_OBJECT_TRACKING){
+            continue;
+        }
 
-    //// Front Loading Loop - If master node is empty - add first element to linked list of objects
-    //// Collects elements for Appending list.
+        // Mounting the head node in the linked list
+        headNode = &OBJECT_TrackerData.object_track_listing.object_list[state->class_id];
+        headNode->last_update = now;
+
+        // Evicts from another class of the shard when its budget is used up
+        newObject = OBJECT_Alloc_Sample(shard, state->class_id);
+        if(newObject == NULL){
+            shard->empty_count++;
+            continue;
+        }
 
-    // Array length for the YOLO-ROS JSON
-    int arrayLen = rovers->arrayLen;
+        newObject->object_state = *state;
+        newObject->track_id = OBJECT_Dict_Track_Id(&OBJECT_TrackerData.Compact, state);
+        newObject->sequence = ++headNode->last_sequence;
+        headNode->version++;
+        newObject->trace = entries[itr]->trace;
 
-    // Creating an array for inserting in the linked list
-    rover_array objectAppendStack[rovers->arrayLen];
+        OBJECT_Link_Sample(shard, newObject);
+        OBJECT_Lifecycle_Observe(&OBJECT_TrackerData.Lifecycle, newObject->track_id, state->class_id, now);
+        inserted++;
+    }
 
-    // Used for tracking future insertions
-    int stackAppendSize = 0;
+    return(inserted);
 
-    int itr;
-    for(itr = 0; itr < arrayLen; itr++){
-        // Setting comparison node
-        travelerNode = rovers->rovers_array[itr];
+}
 
-        // Grabbing the class-id, this dictates the array index position
-        uint8 indx = travelerNode.class_id;
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  OBJECT_Link_Sample                                                 */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Links a filled sample into its class history in time order.        */
+/*         Runs on the shard owning the class, nothing else changes that      */
+/*         history meanwhile.                                                 */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * *  * *  * * * * */
+void OBJECT_Link_Sample(OBJECT_Shard_t *shard, Object_Node_t *newObject){
+    Object_Master_Node_t *headNode;
+    Object_Node_t *travelerNode = NULL;
+    const rover_state *state = &newObject->object_state;
+    bool delayed;
+
+    headNode = &OBJECT_TrackerData.object_track_listing.object_list[state->class_id];
+
+    // Delayed sample - walks back to the newest older sample, outside the lock
+    delayed = (headNode->latest_node != NULL) &&
+              OBJECT_State_Before(state, &headNode->latest_node->object_state);
+    if(delayed){
+        travelerNode = headNode->latest_node;
+        while((travelerNode != NULL) && OBJECT_State_Before(state, &travelerNode->object_state)){
+            travelerNode = travelerNode->previous_node;
+        }
+    }
 
-        // Mounting the head node in the linked list
-        headNode = OBJECT_TrackerData.object_track_listing.object_list[indx];
+    // Open snapshots don't see nodes born in their epoch
+    OBJECT_Epoch_Lock(&shard->epoch);
+    newObject->born_epoch = shard->epoch.epoch;
 
-        // If the master node doesn't exist - create it and add the first element
-        if(headNode == NULL){
-            Object_Master_Node_t new_master_node;
-            new_master_node.class_id = indx;
-            headNode = &new_master_node;
-        }
-    
-        // If there is no starter node - add it
-        if(headNode->start_node == NULL){
-            headNode->start_node = travelerNode;
-            headNode->latest_node = travelerNode;
-            headNode->total_node_len++;
-        } else {
-            // Add it to the append stack to append in next phase
-            objectAppendStack[stackAppendSize++] = travelerNode;
-        }
+    if(!delayed){
+        // Add to the end of the linked list
+        appendLL(headNode, newObject);
+    } else {
+        insertLL(headNode, travelerNode, newObject);
     }
 
+    OBJECT_Epoch_Unlock(&shard->epoch);
 
-    //// Appending loop - will check and add the elements to the end of the linked list
-    //// Also collects insert elements for insertion loop
+    newObject->trace.inserted_us = OBJECT_Latency_Now();
 
-    // Array length for the YOLO-ROS JSON
-    //arrayLen = rovers->arrayLen;
+} /* End of OBJECT_Link_Sample */
 
-    // Creating an array for inserting in the linked list
-    rover_array objectInsertStack[stackAppendSize];
+// TO-DO: USE C BASED GENERICS AND MACROS TO SUPPORT MULTIPLE DATA/STRUCT TYPES
+// Inserts 'newObject' after 'objectNode', or at the start of the list when it is NULL
+void insertLL(Object_Master_Node_t *headObject, Object_Node_t *objectNode, Object_Node_t *newObject){
+
+    newObject->beenPublished = false;
+    newObject->previous_node = objectNode;
+
+    // The new node is complete before snapshot readers can reach it
+    if(objectNode == NULL){
+        newObject->next_node = headObject->start_node;
+        headObject->start_node = newObject;
+    } else {
+        newObject->next_node = objectNode->next_node;
+        OBJECT_EPOCH_STORE_RELEASE(&objectNode->next_node, newObject);
+    }
 
-    // Used for tracking future insertions
-    int stackinsertSize = 0;
-    
-    for(itr = 0; itr < stackAppendSize; itr++){
-        // Setting comparison node
-        //travelerNode = rovers->rovers_array[itr];
-        travelerNode = objectAppendStack[itr];
+    // Changing what the next objects previous object link
+    if(newObject->next_node != NULL){
+        newObject->next_node->previous_node = newObject;
+    } else {
+        headObject->latest_node = newObject;
+    }
 
-        // Grabbing the class-id, this dictates the array index position
-        uint8 indx = travelerNode.class_id;
+    headObject->total_node_len++;
 
-        // Mounting the head node in the linked list
-        headNode = OBJECT_TrackerData.object_track_listing.object_list[indx];
+}
+
+// TO-DO: USE C BASED GENERICS AND MACROS TO SUPPORT MULTIPLE DATA/STRUCT TYPES
+void appendLL(Object_Master_Node_t *headObject, Object_Node_t *newObject){
 
-        // Checking if the latest timestamp is less than the new input
-        if(headNode->enable_switch){
+    // Link the nodes
+    newObject->previous_node = headObject->latest_node;
+    newObject->next_node = NULL;
 
-            // Pulling the local time from the latest node
-            local_time_sec = headNode->latest_node->latest_node.object_state.timeStamp_sec;
-            local_time_nanoSec = headNode->latest_node->latest_node.object_state.timeStamp_nanoSec;
+    // Initialize the publish bool
+    newObject->beenPublished = false;
 
-            if((local_time_sec >= time_sec) && (local_time_nanoSec >= time_nanoSec)){
-                // Add to the end of the linked list
-                appendList(headNode, travelerNode);
-            } else {
-                // Add to the stack to loop over later
-                objectInsertArr[stackinsertSize++] = travelerNode;
-            }
-        }
+    // Relinking the master node for the object
+    if(headObject->latest_node != NULL){
+        OBJECT_EPOCH_STORE_RELEASE(&headObject->latest_node->next_node, newObject);
+    } else {
+        headObject->start_node = newObject;
+    }
+
+    // Relinking master node to new apended node
+    headObject->latest_node = newObject;
+
+    // Increasing the total node len size
+    headObject->total_node_len++;
+
+}
+
+// TO-DO: USE C BASED GENERICS AND MACROS TO SUPPORT MULTIPLE DATA/STRUCT TYPES
+// Removes a node from its list, the caller returns it to the sample pool.
+// The node keeps its own links for snapshot readers still standing on it.
+void unlinkLL(Object_Master_Node_t *headObject, Object_Node_t *objectNode){
+
+    if(objectNode->previous_node != NULL){
+        OBJECT_EPOCH_STORE_RELEASE(&objectNode->previous_node->next_node, objectNode->next_node);
+    } else {
+        headObject->start_node = objectNode->next_node;
     }
 
+    if(objectNode->next_node != NULL){
+        objectNode->next_node->previous_node = objectNode->previous_node;
+    } else {
+        headObject->latest_node = objectNode->previous_node;
+    }
 
-    //// Insertion Loop - will insert element in the proper position, won't publish until entire list is sent to software bus 
-    //// Nothing to insert, exit from function
-    if(stackinsertSize <= 0){
-        return(2);
+    // Removed nodes left the count when they were removed
+    if(objectNode->dead_epoch == 0){
+        headObject->total_node_len--;
     }
 
-    // Brute Force method for inserting in linear O(n * m) == O(n) time
-    // A way of de-nesting the loop needed for linked list insertion
+}
 
-    // Setting comparison node
-    rover_state insertTraveler = objectInsertArr[itr];
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  OBJECT_Unlink_Sample                                               */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Takes a sample out of its class history, call with the shard's    */
+/*         epoch lock held. True when it was unlinked and can go back to the  */
+/*         pool, false when it stays linked, marked removed, for a snapshot.  */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * *  * *  * * * * */
+static bool OBJECT_Unlink_Sample(OBJECT_Epoch_t *domain, Object_Master_Node_t *headNode, Object_Node_t *node){
 
-    // Grabbing the class-id, this dictates the array index position
-    uint8 indx = travelerNode.class_id;
+    if(!OBJECT_Epoch_Pinned(domain)){
+        unlinkLL(headNode, node);
+        return(true);
+    }
 
-    // Mounting the staring node
-    Object_Node_t *travelerObjectNode = OBJECT_TrackerData.object_track_listing.object_list[indx]->start_node;
+    node->dead_epoch = domain->epoch;
+    headNode->total_node_len--;
 
+    OBJECT_Epoch_Defer(&domain->dead_head, &domain->dead_tail, node);
+    domain->deferred_count++;
 
-    itr = 0;
-    int outer_itr = 0;
-    while(itr < stackinsertSize){
-        // Pulling the local time from the latest node
-        local_time_sec = travelerObjectNode.object_state.timeStamp_sec;
-        local_time_nanoSec = travelerObjectNode.object_state.timeStamp_nanoSec;
-
-        // This only activates when bounds are present, should never activate unless there's an error
-        if(travelerObjectNode == NULL){
-            appendList(headNode, insertTraveler);
+    return(false);
+
+} /* End of OBJECT_Unlink_Sample */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  OBJECT_Alloc_Sample                                                */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Takes a node from the shard's sample pool. When its budget is used */
+/*         up the oldest sample of the shard's lowest priority, least         */
+/*         recently updated class above its minimum reservation is evicted    */
+/*         and reused. While an open snapshot holds the evicted sample back,  */
+/*         a headroom node is used, and with the headroom used up nothing is  */
+/*         evicted. Returns NULL when no node can be had.                     */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * *  * *  * * * * */
+Object_Node_t *OBJECT_Alloc_Sample(OBJECT_Shard_t *shard, uint8 class_id){
+    Object_Master_Node_t *headNode;
+    Object_Master_Node_t *victim = NULL;
+    Object_Node_t *node;
+    bool unlinked;
+    int itr;
+
+    node = OBJECT_Pool_Alloc(&shard->pool);
+    if(node != NULL){
+        return(node);
+    }
+
+    // Closed snapshots may have released removed samples
+    OBJECT_Reclaim_Samples(shard);
+
+    node = OBJECT_Pool_Alloc(&shard->pool);
+    if(node != NULL){
+        return(node);
+    }
+
+    for(itr = shard->index; itr < MAX_OBJECT_TRACKING; itr += OBJECT_TrackerData.Shards.shard_count){
+        headNode = &OBJECT_TrackerData.object_track_listing.object_list[itr];
+
+        // Classes below their reservation keep their samples, except to
+        // make room for themselves
+        if((headNode->total_node_len <= 0) ||
+           ((headNode->total_node_len <= OBJECT_CLASS_MIN_SAMPLES) && (itr != class_id))){
+            continue;
         }
 
-        if((local_time_sec >= time_sec) && (local_time_nanoSec >= time_nanoSec)){
-            // Add to the end of the linked list
-            insert(stackinsertSize, insertTraveler);
+        if((victim == NULL) ||
+           (headNode->priority < victim->priority) ||
+           ((headNode->priority == victim->priority) &&
+            ((int32) (headNode->last_update - victim->last_update) < 0))){
+            victim = headNode;
+        }
+    }
 
-            // Preincrement and load the next object node
-            insertTraveler = objectInsertArr[++itr];
+    if(victim == NULL){
+        return(NULL);
+    }
 
-            // Grabbing the class-id, this dictates the array index position
-            indx = insertTraveler.class_id;
-        
-            // Mounting the next staring node
-            travelerObjectNode = OBJECT_TrackerData.object_track_listing.object_list[indx]->start_node;
-        } else {
-            // Increment the linked list to check the next node
-            travelerObjectNode = travelerObjectNode.next_node;
+    // Oldest sample that hasn't been removed already
+    node = victim->start_node;
+    while(node->dead_epoch != 0){
+        node = node->next_node;
+    }
+
+    // Checked under the lock the eviction takes, so a snapshot opened in
+    // between can't leave the class a sample short with nothing stored
+    OBJECT_Epoch_Lock(&shard->epoch);
+
+    if(OBJECT_Epoch_Pinned(&shard->epoch) && (shard->pool.reserve_count == 0)){
+        OBJECT_Epoch_Unlock(&shard->epoch);
+        return(NULL);
+    }
+
+    victim->version++;
+    unlinked = OBJECT_Unlink_Sample(&shard->epoch, victim, node);
+
+    OBJECT_Epoch_Unlock(&shard->epoch);
+
+    if(unlinked){
+        OBJECT_Pool_Free(&shard->pool, node);
+    }
+
+    victim->evicted_count++;
+    shard->evicted_count++;
+
+    // NULL while an open snapshot sees the evicted sample, which then
+    // counts against the headroom until it is reclaimed
+    node = OBJECT_Pool_Alloc(&shard->pool);
+    if(node == NULL){
+        node = OBJECT_Pool_Alloc_Reserve(&shard->pool);
+    }
+
+    return(node);
+
+} /* End of OBJECT_Alloc_Sample */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  OBJECT_Remove_Sample                                               */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Takes a sample out of its class history. Without open snapshots it */
+/*         goes straight back to the pool, otherwise it stays linked, marked  */
+/*         removed, until OBJECT_Reclaim_Samples finds no snapshot needs it.  */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * *  * *  * * * * */
+void OBJECT_Remove_Sample(OBJECT_Shard_t *shard, Object_Master_Node_t *headNode, Object_Node_t *node){
+    OBJECT_Epoch_t *domain = &shard->epoch;
+    bool unlinked;
+
+    headNode->version++;
+
+    OBJECT_Epoch_Lock(domain);
+    unlinked = OBJECT_Unlink_Sample(domain, headNode, node);
+    OBJECT_Epoch_Unlock(domain);
+
+    if(unlinked){
+        OBJECT_Pool_Free(&shard->pool, node);
+    }
+
+} /* End of OBJECT_Remove_Sample */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  OBJECT_Reclaim_Samples                                             */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Unlinks a shard's removed samples no open snapshot can see any     */
+/*         more, and returns unlinked samples no open snapshot can be         */
+/*         standing on to the shard's pool                                    */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * *  * *  * * * * */
+void OBJECT_Reclaim_Samples(OBJECT_Shard_t *shard){
+    OBJECT_Epoch_t *domain = &shard->epoch;
+    Object_Node_t *node;
+    uint32 oldest;
+
+    OBJECT_Epoch_Lock(domain);
+
+    oldest = OBJECT_Epoch_Oldest(domain);
+
+    while(((node = domain->dead_head) != NULL) && ((int32) (node->dead_epoch - oldest) < 0)){
+        domain->dead_head = node->retired_next;
+        if(domain->dead_head == NULL){
+            domain->dead_tail = NULL;
         }
-        
+
+        unlinkLL(&OBJECT_TrackerData.object_track_listing.object_list[node->object_state.class_id], node);
+        node->unlinked_epoch = domain->epoch;
+
+        OBJECT_Epoch_Defer(&domain->unlinked_head, &domain->unlinked_tail, node);
     }
 
-    // Done
-    return(1);
+    while(((node = domain->unlinked_head) != NULL) && ((int32) (node->unlinked_epoch - oldest) < 0)){
+        domain->unlinked_head = node->retired_next;
+        if(domain->unlinked_head == NULL){
+            domain->unlinked_tail = NULL;
+        }
 
-}
+        OBJECT_Pool_Free(&shard->pool, node);
+        domain->deferred_count--;
+    }
 
-// TO-DO: USE C BASED GENERICS AND MACROS TO SUPPORT MULTIPLE DATA/STRUCT TYPES
-void insertLL(Object_Node_t *objectNode, rover_state *objectData){
-    // Creating new object to insert
-    Object_Node_t newObject;
+    OBJECT_Epoch_Unlock(domain);
 
-    // Setting the object data
-    newObject.object_state = objectData;
+} /* End of OBJECT_Reclaim_Samples */
 
-    // Changing what the next objects previous object link
-    objectNode->next_node->previous_node = &newObject;
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  OBJECT_Age_Tracks                                                  */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Called by every shard each cycle. Advances the shard's track timer */
+/*         wheel, deleting the tracks whose timeouts elapsed, and reclaims    */
+/*         its released samples                                               */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * *  * *  * * * * */
+void OBJECT_Age_Tracks(OBJECT_Shard_t *shard){
 
-    // Setting the new inserted objects next and previous nodes
-    // The new nodes will always be place in front of the previous node
-    newObject.previous_node = objectNode;
-    newObject.next_node = objectNode->next_node;
+    OBJECT_Lifecycle_Advance(&OBJECT_TrackerData.Lifecycle, shard->index, OBJECT_Lifecycle_Now(), OBJECT_Delete_Track);
 
-    // The new node is placed in front of the old node
-    // Changing association 
-    objectNode->next_node = &newObject;
+    // Samples held back for snapshots closed since the last cycle
+    OBJECT_Reclaim_Samples(shard);
 
-}
+} /* End of OBJECT_Age_Tracks */
 
-// TO-DO: USE C BASED GENERICS AND MACROS TO SUPPORT MULTIPLE DATA/STRUCT TYPES
-void appendLL(Object_Master_Node_t *headObject, rover_state *newNode){
-    // Initializing a traveler node for the linked list
-    Object_Node_t newObject;
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  OBJECT_Delete_Track                                                */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Returns a deleted track's samples to the pool and releases its     */
+/*         track id. A class left without samples expires with it. Runs on    */
+/*         the shard owning the class.                                        */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * *  * *  * * * * */
+void OBJECT_Delete_Track(uint16 track_id, uint8 class_id){
+    Object_Master_Node_t *headNode;
+    Object_Node_t *node;
+    Object_Node_t *next;
+    uint32 freed = 0;
 
-    // Copying the object over
-    // TO-DO: USE C BASED GENERICS AND MACROS TO SUPPORT MULTIPLE DATA/STRUCT TYPES
-    newObject.object_state = newNode;
+    if((track_id == 0) || (track_id > OBJECT_DICT_MAX_TRACKS)){
+        return;
+    }
 
-    // Link the nodes
-    newObject.previous_node = headObject->latest_node;
-    newObject.next_node = NULL;
+    if(class_id < MAX_OBJECT_TRACKING){
+        headNode = &OBJECT_TrackerData.object_track_listing.object_list[class_id];
 
-    // Initialize the publish bool
-    newObject.beenPublished = false;
+        for(node = headNode->start_node; node != NULL; node = next){
+            next = node->next_node;
 
-    // Relinking the master node for the object
-    headObject->latest_node->next_node = &newObject;
+            if((node->track_id == track_id) && (node->dead_epoch == 0)){
+                OBJECT_Remove_Sample(OBJECT_Shard_Of_Class(&OBJECT_TrackerData.Shards, class_id), headNode, node);
+                freed++;
+            }
+        }
+    }
 
-    // Relinking master node to new apended node
-    headObject->latest_node = &newObject;
+    OBJECT_Dict_Release(&OBJECT_TrackerData.Compact, track_id);
+    memset(&OBJECT_TrackerData.Kinematics.tracks[track_id - 1], 0, sizeof(OBJECT_Kinematics_Track_t));
+    OBJECT_Keypoints_Clear_Track(&OBJECT_TrackerData.Keypoints, track_id);
+    OBJECT_Stats_Clear_Track(&OBJECT_TrackerData.Stats, track_id);
+    OBJECT_Window_Clear_Track(&OBJECT_TrackerData.Window, track_id);
+    OBJECT_Latest_Clear_Track(&OBJECT_TrackerData.Latest, track_id);
 
-    // Increasing the total node len size
-    newObject->total_node_len++;
+    CFE_EVS_SendEvent(OBJECT_TRACK_DEL_DBG_EID,
+                      CFE_EVS_EventType_DEBUG,
+                      "Track %u of class %u deleted, %lu samples freed",
+                      track_id, class_id, (unsigned long) freed);
 
-}
+} /* End of OBJECT_Delete_Track */
 
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
 /*  Name:  OBJECT_Switch_Request                                              */
@@ -710,42 +1539,875 @@ void  OBJECT_Switch_Request(const OBJECT_Switch_t *Msg){
     // Saving the message bool value to enable or disable publishing to the software bus
     bool enable_disable = Msg->switchCMD;
 
+    if(class_id_indx >= MAX_OBJECT_TRACKING){
+        OBJECT_TrackerData.ErrCounter++;
+
+        CFE_EVS_SendEvent(OBJECT_COMMAND_ERR_EID,
+                          CFE_EVS_EventType_ERROR,
+                          "Invalid class id for switch: %d",
+                          class_id_indx);
+        return;
+    }
+
     // Switching the publisher flag to 'on' or 'off' in the head element in the array
     OBJECT_TrackerData.object_track_listing.object_list[class_id_indx].enable_switch = enable_disable;
 
+    // Keeps the subscription mask in step
+    OBJECT_Filter_Set_Class(&OBJECT_TrackerData.Filter, class_id_indx, enable_disable);
+
 } /* End of OBJECT_Switch_Request */
 
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  OBJECT_Format_Request                                              */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Selects the essentials telemetry wire format                       */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * *  * *  * * * * */
+void OBJECT_Format_Request(const OBJECT_Format_t *Msg){
+
+    if((Msg->format != OBJECT_ESS_FORMAT_FULL) && (Msg->format != OBJECT_ESS_FORMAT_COMPACT)){
+        OBJECT_TrackerData.ErrCounter++;
+
+        CFE_EVS_SendEvent(OBJECT_FORMAT_ERR_EID,
+                          CFE_EVS_EventType_ERROR,
+                          "Invalid essentials format: %d",
+                          Msg->format);
+        return;
+    }
+
+    // Nothing stays queued in the old format
+    OBJECT_Compact_Flush(&OBJECT_TrackerData.Compact);
+
+    OBJECT_TrackerData.Compact.format = Msg->format;
+    OBJECT_TrackerData.EssIncludePose = (Msg->include_pose != 0);
+    OBJECT_TrackerData.EssIncludePrediction = (Msg->include_prediction != 0);
+
+    // Ground needs the dictionary before the first compact packet
+    OBJECT_TrackerData.Compact.dict_changed = true;
+
+    OBJECT_TrackerData.CmdCounter++;
+
+    CFE_EVS_SendEvent(OBJECT_FORMAT_INF_EID,
+                      CFE_EVS_EventType_INFORMATION,
+                      "Essentials format set to %s%s%s",
+                      (Msg->format == OBJECT_ESS_FORMAT_COMPACT) ? "compact" : "full",
+                      OBJECT_TrackerData.EssIncludePose ? " with pose" : "",
+                      OBJECT_TrackerData.EssIncludePrediction ? " with prediction" : "");
+
+} /* End of OBJECT_Format_Request */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  OBJECT_Priority_Request                                            */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Sets the eviction priority of a class                              */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * *  * *  * * * * */
+void OBJECT_Priority_Request(const OBJECT_Priority_t *Msg){
+
+    if(Msg->class_id >= MAX_OBJECT_TRACKING){
+        OBJECT_TrackerData.ErrCounter++;
+
+        CFE_EVS_SendEvent(OBJECT_PRIORITY_ERR_EID,
+                          CFE_EVS_EventType_ERROR,
+                          "Invalid class id for priority: %d",
+                          Msg->class_id);
+        return;
+    }
+
+    OBJECT_TrackerData.object_track_listing.object_list[Msg->class_id].priority = Msg->priority;
+
+    OBJECT_TrackerData.CmdCounter++;
+
+    CFE_EVS_SendEvent(OBJECT_PRIORITY_INF_EID,
+                      CFE_EVS_EventType_INFORMATION,
+                      "Class %d eviction priority set to %d",
+                      Msg->class_id, Msg->priority);
+
+} /* End of OBJECT_Priority_Request */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  OBJECT_Publish_Rate_Request                                        */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Sets the publish priority and maximum publish rate of a class      */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * *  * *  * * * * */
+void OBJECT_Publish_Rate_Request(const OBJECT_Publish_Rate_t *Msg){
+    OBJECT_Sched_Class_t *class;
+
+    if(Msg->class_id >= MAX_OBJECT_TRACKING){
+        OBJECT_TrackerData.ErrCounter++;
+
+        CFE_EVS_SendEvent(OBJECT_SCHED_ERR_EID,
+                          CFE_EVS_EventType_ERROR,
+                          "Invalid class id for publish rate: %d",
+                          Msg->class_id);
+        return;
+    }
+
+    class = &OBJECT_TrackerData.Sched.classes[Msg->class_id];
+    class->priority = Msg->priority;
+    class->max_rate_mhz = Msg->max_rate_mhz;
+
+    // Starts with one sample's worth rather than a full burst
+    class->tokens = (Msg->max_rate_mhz != 0) ? 1.0 : 0.0;
+
+    OBJECT_TrackerData.CmdCounter++;
+
+    CFE_EVS_SendEvent(OBJECT_SCHED_INF_EID,
+                      CFE_EVS_EventType_INFORMATION,
+                      "Class %d publish priority %d, max rate %lu mHz",
+                      Msg->class_id, Msg->priority,
+                      (unsigned long) Msg->max_rate_mhz);
+
+} /* End of OBJECT_Publish_Rate_Request */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  OBJECT_Publish_Budget_Request                                      */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Sets the message and byte budget of every publish cycle            */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * *  * *  * * * * */
+void OBJECT_Publish_Budget_Request(const OBJECT_Publish_Budget_t *Msg){
+
+    if((Msg->max_msgs == 0) || (Msg->max_bytes == 0)){
+        OBJECT_TrackerData.ErrCounter++;
+
+        CFE_EVS_SendEvent(OBJECT_SCHED_ERR_EID,
+                          CFE_EVS_EventType_ERROR,
+                          "Invalid publish budget: %u msgs, %lu bytes",
+                          Msg->max_msgs,
+                          (unsigned long) Msg->max_bytes);
+        return;
+    }
+
+    OBJECT_TrackerData.Sched.max_msgs = Msg->max_msgs;
+    OBJECT_TrackerData.Sched.max_bytes = Msg->max_bytes;
+
+    OBJECT_TrackerData.CmdCounter++;
+
+    CFE_EVS_SendEvent(OBJECT_SCHED_INF_EID,
+                      CFE_EVS_EventType_INFORMATION,
+                      "Publish budget set to %u msgs, %lu bytes per cycle",
+                      Msg->max_msgs,
+                      (unsigned long) Msg->max_bytes);
+
+} /* End of OBJECT_Publish_Budget_Request */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  OBJECT_Subscribe_Request                                           */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Replaces the enabled classes and the detection limits of the       */
+/*         publish subscription                                               */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * *  * *  * * * * */
+void OBJECT_Subscribe_Request(const OBJECT_Subscribe_t *Msg){
+    OBJECT_Filter_t *filter = &OBJECT_TrackerData.Filter;
+    uint32 enabled = 0;
+    int itr;
+
+    if((Msg->min_confidence < 0.0f) || (Msg->min_distance < 0.0f) || (Msg->max_distance < 0.0f) ||
+       ((Msg->max_distance != 0.0f) && (Msg->max_distance < Msg->min_distance))){
+        OBJECT_TrackerData.ErrCounter++;
+
+        CFE_EVS_SendEvent(OBJECT_SUBSCRIBE_ERR_EID,
+                          CFE_EVS_EventType_ERROR,
+                          "Invalid subscription limits: confidence %f, distance %f to %f",
+                          Msg->min_confidence, Msg->min_distance, Msg->max_distance);
+        return;
+    }
+
+    memcpy(filter->class_mask, Msg->class_mask, sizeof(filter->class_mask));
+    filter->min_confidence = Msg->min_confidence;
+    filter->min_distance = Msg->min_distance;
+    filter->max_distance = Msg->max_distance;
+
+    // Tracked classes follow the mask
+    for(itr = 0; itr < MAX_OBJECT_TRACKING; itr++){
+        OBJECT_TrackerData.object_track_listing.object_list[itr].enable_switch = OBJECT_Filter_Class(filter, itr);
+        if(OBJECT_TrackerData.object_track_listing.object_list[itr].enable_switch){
+            enabled++;
+        }
+    }
+
+    OBJECT_TrackerData.CmdCounter++;
+
+    CFE_EVS_SendEvent(OBJECT_SUBSCRIBE_INF_EID,
+                      CFE_EVS_EventType_INFORMATION,
+                      "Subscribed to %lu classes, confidence %f, distance %f to %f",
+                      (unsigned long) enabled, Msg->min_confidence,
+                      Msg->min_distance, Msg->max_distance);
+
+} /* End of OBJECT_Subscribe_Request */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  OBJECT_Fuse_Config_Request                                         */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Sets the distance and orientation gate of duplicate fusion         */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * *  * *  * * * * */
+void OBJECT_Fuse_Config_Request(const OBJECT_Fuse_Config_t *Msg){
+
+    if((Msg->distance_gate < 0.0f) || (Msg->orientation_gate < 0.0f) || (Msg->orientation_gate > 180.0f)){
+        OBJECT_TrackerData.ErrCounter++;
+
+        CFE_EVS_SendEvent(OBJECT_FUSE_ERR_EID,
+                          CFE_EVS_EventType_ERROR,
+                          "Invalid fusion gate: %f m, %f deg",
+                          Msg->distance_gate, Msg->orientation_gate);
+        return;
+    }
+
+    OBJECT_TrackerData.Fuse.distance_gate = Msg->distance_gate;
+    OBJECT_TrackerData.Fuse.orientation_gate = Msg->orientation_gate;
+
+    OBJECT_TrackerData.CmdCounter++;
+
+    CFE_EVS_SendEvent(OBJECT_FUSE_INF_EID,
+                      CFE_EVS_EventType_INFORMATION,
+                      "Fusion gate set to %f m, %f deg",
+                      Msg->distance_gate, Msg->orientation_gate);
+
+} /* End of OBJECT_Fuse_Config_Request */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  OBJECT_Export_Request                                              */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Hands the requested histories, as stored so far, to the export     */
+/*         task, which writes them to a cFE file                              */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * *  * *  * * * * */
+void OBJECT_Export_Request(const OBJECT_Export_History_t *Msg){
+    OBJECT_Export_t *exporter = &OBJECT_TrackerData.Export;
+    int itr;
+
+    if(((Msg->class_id >= MAX_OBJECT_TRACKING) && (Msg->class_id != OBJECT_PREDICT_ALL_CLASSES)) ||
+       (memchr(Msg->filename, '\0', sizeof(Msg->filename)) == NULL) || (Msg->filename[0] == '\0') ||
+       ((Msg->end_sec != 0) && (Msg->end_sec < Msg->start_sec))){
+        OBJECT_TrackerData.ErrCounter++;
+
+        CFE_EVS_SendEvent(OBJECT_EXPORT_ERR_EID,
+                          CFE_EVS_EventType_ERROR,
+                          "Invalid history export: class %d, seconds %lu to %lu",
+                          Msg->class_id,
+                          (unsigned long) Msg->start_sec,
+                          (unsigned long) Msg->end_sec);
+        return;
+    }
+
+    if(OBJECT_Export_Busy(exporter)){
+        OBJECT_TrackerData.ErrCounter++;
+
+        CFE_EVS_SendEvent(OBJECT_EXPORT_ERR_EID,
+                          CFE_EVS_EventType_ERROR,
+                          "History export refused: export to %s still running",
+                          exporter->filename);
+        return;
+    }
+
+    // Samples stored from here on are left out of the file
+    for(itr = 0; itr < MAX_OBJECT_TRACKING; itr++){
+        exporter->last_sequence[itr] = OBJECT_TrackerData.object_track_listing.object_list[itr].last_sequence;
+    }
+
+    strncpy(exporter->filename, Msg->filename, sizeof(exporter->filename));
+    exporter->class_id = Msg->class_id;
+    exporter->start_sec = Msg->start_sec;
+    exporter->end_sec = Msg->end_sec;
+
+    OBJECT_Export_Start(exporter);
+
+    OBJECT_TrackerData.CmdCounter++;
+
+    CFE_EVS_SendEvent(OBJECT_EXPORT_INF_EID,
+                      CFE_EVS_EventType_INFORMATION,
+                      "History export of class %d to %s started",
+                      Msg->class_id,
+                      exporter->filename);
+
+} /* End of OBJECT_Export_Request */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  OBJECT_Predict_Request                                             */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Replies with the state of every confirmed or coasting track        */
+/*         predicted to the requested cFE time                                */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * *  * *  * * * * */
+void OBJECT_Predict_Request(const OBJECT_Predict_t *Msg){
+    OBJECT_Prediction_Payload_t *payload = &OBJECT_TrackerData.prediction_msg.Payload;
+    CFE_TIME_SysTime_t time;
+    uint16 track_ids[OBJECT_DICT_MAX_TRACKS];
+    uint16 total = 0;
+    uint16 track_id;
+    uint16 itr;
+    uint8  state;
+    double at;
+
+    if((Msg->class_id >= MAX_OBJECT_TRACKING) && (Msg->class_id != OBJECT_PREDICT_ALL_CLASSES)){
+        OBJECT_TrackerData.ErrCounter++;
+
+        CFE_EVS_SendEvent(OBJECT_PREDICT_ERR_EID,
+                          CFE_EVS_EventType_ERROR,
+                          "Invalid class id for prediction: %d",
+                          Msg->class_id);
+        return;
+    }
+
+    // 0/0 predicts for the time the request is handled
+    if((Msg->seconds == 0) && (Msg->subseconds == 0)){
+        time = CFE_TIME_GetTime();
+    } else {
+        time.Seconds = Msg->seconds;
+        time.Subseconds = Msg->subseconds;
+    }
+    at = OBJECT_Predict_Time(time);
+
+    // Tentative tracks may be clutter and deleted ones have no state
+    for(track_id = 1; track_id <= OBJECT_DICT_MAX_TRACKS; track_id++){
+        state = OBJECT_TrackerData.Lifecycle.tracks[track_id - 1].state;
+
+        if(((state == OBJECT_TRACK_CONFIRMED) || (state == OBJECT_TRACK_COASTING)) &&
+           ((Msg->class_id == OBJECT_PREDICT_ALL_CLASSES) ||
+            (OBJECT_TrackerData.Compact.tracks[track_id - 1].class_id == Msg->class_id))){
+            track_ids[total++] = track_id;
+        }
+    }
+
+    payload->seconds = time.Seconds;
+    payload->subseconds = time.Subseconds;
+    payload->total_entries = total;
+
+    // Always at least one reply, even when no track qualifies
+    itr = 0;
+    do{
+        payload->first_entry = itr;
+        payload->entry_count = 0;
+
+        for(; (itr < total) && (payload->entry_count < OBJECT_PREDICT_MAX_ENTRIES); itr++){
+            OBJECT_Predict_Track(&OBJECT_TrackerData.Kinematics, &OBJECT_TrackerData.Compact,
+                                 track_ids[itr], at, &payload->entries[payload->entry_count++]);
+        }
+
+        CFE_SB_SetTotalMsgLength((CFE_SB_MsgPtr_t) &OBJECT_TrackerData.prediction_msg,
+                                 sizeof(OBJECT_TrackerData.prediction_msg) -
+                                 ((OBJECT_PREDICT_MAX_ENTRIES - payload->entry_count) * sizeof(OBJECT_Prediction_Data_t)));
+        CFE_SB_TimeStampMsg((CFE_SB_MsgPtr_t) &OBJECT_TrackerData.prediction_msg);
+        CFE_SB_SendMsg((CFE_SB_MsgPtr_t) &OBJECT_TrackerData.prediction_msg);
+    } while(itr < total);
+
+    OBJECT_TrackerData.CmdCounter++;
+
+    CFE_EVS_SendEvent(OBJECT_PREDICT_DBG_EID,
+                      CFE_EVS_EventType_DEBUG,
+                      "Predicted %u tracks to %lu.%05lu",
+                      total,
+                      (unsigned long) time.Seconds,
+                      (unsigned long) (CFE_TIME_Sub2MicroSecs(time.Subseconds) / 10));
+
+} /* End of OBJECT_Predict_Request */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  OBJECT_Latency_Sla_Request                                         */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Sets the detection-to-publish p99 latency SLA                      */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * *  * *  * * * * */
+void OBJECT_Latency_Sla_Request(const OBJECT_Latency_Sla_t *Msg){
+
+    OBJECT_TrackerData.Latency.sla_p99_us = Msg->sla_p99_us;
+
+    // Re-evaluated from scratch at the next report
+    OBJECT_TrackerData.Latency.sla_violated = false;
+
+    OBJECT_TrackerData.CmdCounter++;
+
+    CFE_EVS_SendEvent(OBJECT_LATENCY_SLA_INF_EID,
+                      CFE_EVS_EventType_INFORMATION,
+                      "Latency SLA set to p99 age %lu us",
+                      (unsigned long) Msg->sla_p99_us);
+
+} /* End of OBJECT_Latency_Sla_Request */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  OBJECT_Window_Query_Request                                        */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Replies with the sliding-window aggregates of one track, one       */
+/*         class or every track                                               */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * *  * *  * * * * */
+void OBJECT_Window_Query_Request(const OBJECT_Window_Query_t *Msg){
+    uint16 total;
+
+    if(((Msg->class_id >= MAX_OBJECT_TRACKING) && (Msg->class_id != OBJECT_PREDICT_ALL_CLASSES)) ||
+       (Msg->track_id > OBJECT_DICT_MAX_TRACKS)){
+        OBJECT_TrackerData.ErrCounter++;
+
+        CFE_EVS_SendEvent(OBJECT_WINDOW_ERR_EID,
+                          CFE_EVS_EventType_ERROR,
+                          "Invalid window query: class %d, track %d",
+                          Msg->class_id, Msg->track_id);
+        return;
+    }
+
+    total = OBJECT_Window_Publish(&OBJECT_TrackerData.Window, Msg->class_id, Msg->track_id);
+
+    OBJECT_TrackerData.CmdCounter++;
+
+    CFE_EVS_SendEvent(OBJECT_WINDOW_DBG_EID,
+                      CFE_EVS_EventType_DEBUG,
+                      "Window aggregates of %u tracks sent",
+                      total);
+
+} /* End of OBJECT_Window_Query_Request */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  OBJECT_Window_Config_Request                                       */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Sets the sliding-window length and per-cycle publishing            */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * *  * *  * * * * */
+void OBJECT_Window_Config_Request(const OBJECT_Window_Config_t *Msg){
+
+    if((Msg->window_ms == 0) || (Msg->window_ms > OBJECT_WINDOW_MS_MAX)){
+        OBJECT_TrackerData.ErrCounter++;
+
+        CFE_EVS_SendEvent(OBJECT_WINDOW_ERR_EID,
+                          CFE_EVS_EventType_ERROR,
+                          "Invalid window length: %lu ms, at most %lu ms",
+                          (unsigned long) Msg->window_ms,
+                          (unsigned long) OBJECT_WINDOW_MS_MAX);
+        return;
+    }
+
+    // Retained samples are reused, a longer window fills up as samples arrive
+    OBJECT_TrackerData.Window.window_ms = Msg->window_ms;
+    OBJECT_TrackerData.Window.publish = (Msg->publish != 0);
+
+    OBJECT_TrackerData.CmdCounter++;
+
+    CFE_EVS_SendEvent(OBJECT_WINDOW_INF_EID,
+                      CFE_EVS_EventType_INFORMATION,
+                      "Window set to %lu ms, publishing %s",
+                      (unsigned long) Msg->window_ms,
+                      OBJECT_TrackerData.Window.publish ? "on" : "off");
+
+} /* End of OBJECT_Window_Config_Request */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  OBJECT_Prepare_Publish                                             */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Collects the unpublished samples of a shard's enabled classes into */
+/*         its output, with everything publishing them needs from the shard's */
+/*         tables. Runs on the shard at the end of the cycle.                 */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * *  * *  * * * * */
+void OBJECT_Prepare_Publish(OBJECT_Shard_t *shard){
+    OBJECT_Shard_Output_t *output = &shard->output;
+    OBJECT_Shard_Class_Out_t *out;
+    OBJECT_Shard_Record_t *record;
+    Object_Master_Node_t *headNode;
+    Object_Node_t *node;
+    const rover_state *state;
+    int indx;
+
+    output->record_count = 0;
+
+    for(indx = shard->index; indx < MAX_OBJECT_TRACKING; indx += OBJECT_TrackerData.Shards.shard_count){
+        out = &output->classes[indx];
+        memset(out, 0, sizeof(*out));
+
+        headNode = &OBJECT_TrackerData.object_track_listing.object_list[indx];
+
+        // Only enabled objects with new samples are published
+        if(!headNode->enable_switch || (headNode->latest_node == NULL) || headNode->latest_node->beenPublished){
+            continue;
+        }
+
+        // Rewinds to the oldest sample that hasn't been published yet,
+        // removed samples waiting for snapshots are passed over
+        node = headNode->latest_node;
+        while((node->previous_node != NULL) &&
+              (!node->previous_node->beenPublished || (node->previous_node->dead_epoch != 0))){
+            node = node->previous_node;
+        }
+
+        // Only samples the subscription wants become records and are charged to the budget
+        out->first_record = output->record_count;
+        for(; node != NULL; node = node->next_node){
+            if((node->dead_epoch == 0) && OBJECT_Lifecycle_Publishable(&OBJECT_TrackerData.Lifecycle, node->track_id)){
+                state = &node->object_state;
+
+                if(!OBJECT_Filter_Match(&OBJECT_TrackerData.Filter, state)){
+                    out->filtered++;
+                } else {
+                    // Output is full, the rest of the class waits for the next cycle
+                    if(output->record_count == OBJECT_SHARD_OUTPUT_RECORDS){
+                        break;
+                    }
+
+                    record = &output->records[output->record_count++];
+                    record->node = node;
+                    record->kinematics = OBJECT_Kinematics_Find(&OBJECT_TrackerData.Kinematics,
+                                                                &OBJECT_TrackerData.Compact, state);
+                    record->pose = NULL;
+                    if(OBJECT_TrackerData.EssIncludePose){
+                        record->pose = OBJECT_Keypoints_Find(&OBJECT_TrackerData.Keypoints, node->track_id,
+                                                             state->timeStamp_sec, state->timeStamp_nanoSec);
+                    }
+                    if(OBJECT_TrackerData.Compact.format == OBJECT_ESS_FORMAT_COMPACT){
+                        OBJECT_Compact_Sample(&OBJECT_TrackerData.Compact, state, &record->sample);
+                    }
+                    out->pending++;
+                }
+            }
+
+            if(out->first == NULL){
+                out->first = node;
+            }
+            out->last = node;
+        }
+    }
+
+} /* End of OBJECT_Prepare_Publish */
+
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
 /*  Name:  OBJECT_Publish_States                                              */
 /*                                                                            */
 /*  Purpose:                                                                  */
-/*         Publishes object states to software-bus                            */
+/*         Publishes object states to software-bus, merging the outputs the   */
+/*         shards prepared in scheduler order                                 */
 /*                                                                            */
 /* * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * *  * *  * * * * */
 void OBJECT_Publish_States(){
+    const OBJECT_Shard_Class_Out_t *out;
+    const OBJECT_Shard_Output_t *output;
+    Object_Node_t *node;
+    uint8  order[MAX_OBJECT_TRACKING];
+    uint32 sampleBytes;
+    uint32 granted;
+    uint32 record;
+    int indx;
+    int itr;
 
-    // Publish Essentials message to software bus if enabled
-    CFE_SB_TimeStampMsg(&OBJECT_TrackerData.HkBuf.MsgHdr);
-    CFE_SB_SendMsg(&OBJECT_TrackerData.HkBuf.MsgHdr);
+    // Budget is charged per sample on the wire
+    if(OBJECT_TrackerData.Compact.format == OBJECT_ESS_FORMAT_COMPACT){
+        sampleBytes = sizeof(OBJECT_Compact_Object_t);
+        OBJECT_Sched_Begin(&OBJECT_TrackerData.Sched, OBJECT_Latency_Now(), OBJECT_COMPACT_MAX_OBJECTS, order);
+    } else {
+        sampleBytes = OBJECT_Essentials_Length();
+        OBJECT_Sched_Begin(&OBJECT_TrackerData.Sched, OBJECT_Latency_Now(), 1, order);
+    }
+
+    // The shards are idle, their outputs and histories hold still until the next cycle
+    for(itr = 0; itr < MAX_OBJECT_TRACKING; itr++){
+        indx = order[itr];
+        output = &OBJECT_Shard_Of_Class(&OBJECT_TrackerData.Shards, indx)->output;
+        out = &output->classes[indx];
+
+        // Disabled or nothing new
+        if(out->first == NULL){
+            continue;
+        }
+
+        // Out of budget or rate, the samples wait for a later cycle
+        granted = OBJECT_Sched_Grant(&OBJECT_TrackerData.Sched, indx, out->pending, sampleBytes);
+        if((out->pending > 0) && (granted == 0)){
+            continue;
+        }
+
+        OBJECT_TrackerData.Filter.filtered_count += out->filtered;
+
+        // Decimated classes send their newest samples
+        for(record = out->first_record + (out->pending - granted); record < out->first_record + out->pending; record++){
+            OBJECT_Publish_Sample(&output->records[record]);
+        }
+
+        // Tentative tracks are marked without being sent, they may be clutter
+        for(node = out->first; ; node = node->next_node){
+            if(node->dead_epoch == 0){
+                node->beenPublished = true;
+            }
+
+            if(node == out->last){
+                break;
+            }
+        }
+    }
+
+    if(OBJECT_TrackerData.Compact.format == OBJECT_ESS_FORMAT_COMPACT){
+        // Sends the partially filled batch and the low-rate dictionary
+        OBJECT_Compact_Flush(&OBJECT_TrackerData.Compact);
+        OBJECT_Dict_Publish(&OBJECT_TrackerData.Compact);
+    }
 
 } /* End of OBJECT_Publish_States */
 
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
-/*  Name:  OBJECT_Publish_Complete_States                                     */
+/*  Name:  OBJECT_Publish_Sample                                              */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Publishes one sample a shard prepared in the selected essentials   */
+/*         format                                                             */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * *  * *  * * * * */
+void OBJECT_Publish_Sample(const OBJECT_Shard_Record_t *record){
+    OBJECT_Essentials_Data_t *payload = &OBJECT_TrackerData.object_essential_state_msg.payload;
+    const rover_state *state = &record->node->object_state;
+    const OBJECT_Kinematics_Data_t *kinematics = record->kinematics;
+    uint32 age_us;
+
+    // Every published sample is timed, whatever the format
+    age_us = OBJECT_Latency_Record(&OBJECT_TrackerData.Latency, &record->node->trace, state, OBJECT_Latency_Now());
+
+    // Batched into the compact packet, sent by 'OBJECT_Compact_Flush'
+    if(OBJECT_TrackerData.Compact.format == OBJECT_ESS_FORMAT_COMPACT){
+        OBJECT_Compact_Add(&OBJECT_TrackerData.Compact, &record->sample, kinematics);
+        return;
+    }
+
+    OBJECT_Essentials_From_State(state, payload);
+    OBJECT_TrackerData.object_essential_state_msg.age_us = age_us;
+
+    // Backlogged samples older than their track's latest go out without kinematics
+    if(kinematics != NULL){
+        OBJECT_TrackerData.object_essential_state_msg.kinematics = *kinematics;
+    } else {
+        memset(&OBJECT_TrackerData.object_essential_state_msg.kinematics, 0, sizeof(OBJECT_Kinematics_Data_t));
+    }
+
+    // Where the track is now, not when the camera saw it
+    if(OBJECT_TrackerData.EssIncludePrediction){
+        OBJECT_Predict_Track(&OBJECT_TrackerData.Kinematics, &OBJECT_TrackerData.Compact,
+                             OBJECT_Dict_Lookup(&OBJECT_TrackerData.Compact, state),
+                             OBJECT_Predict_Time(CFE_TIME_GetTime()),
+                             &OBJECT_TrackerData.object_essential_state_msg.prediction);
+    } else {
+        memset(&OBJECT_TrackerData.object_essential_state_msg.prediction, 0, sizeof(OBJECT_Prediction_Data_t));
+    }
+
+    if(OBJECT_TrackerData.EssIncludePose){
+        // Sample without a track or older than the side buffer - sent with an empty pose
+        if(record->pose != NULL){
+            OBJECT_TrackerData.object_essential_state_msg.pose = *record->pose;
+        } else {
+            memset(&OBJECT_TrackerData.object_essential_state_msg.pose, 0, sizeof(OBJECT_Pose_Data_t));
+        }
+    }
+
+    // The message ends after the last enabled block
+    CFE_SB_SetTotalMsgLength(&OBJECT_TrackerData.object_essential_state_msg.MsgHdr, OBJECT_Essentials_Length());
+
+    CFE_SB_TimeStampMsg(&OBJECT_TrackerData.object_essential_state_msg.MsgHdr);
+    CFE_SB_SendMsg(&OBJECT_TrackerData.object_essential_state_msg.MsgHdr);
+
+} /* End of OBJECT_Publish_Sample */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  OBJECT_Essentials_Length                                           */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Length of a full format essentials message, which ends after       */
+/*         the last enabled block                                             */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * *  * *  * * * * */
+uint16 OBJECT_Essentials_Length(void){
+
+    if(OBJECT_TrackerData.EssIncludePose){
+        return(sizeof(OBJECT_TrackerData.object_essential_state_msg));
+    }
+
+    if(OBJECT_TrackerData.EssIncludePrediction){
+        return(sizeof(OBJECT_TrackerData.object_essential_state_msg) - sizeof(OBJECT_Pose_Data_t));
+    }
+
+    return(sizeof(OBJECT_TrackerData.object_essential_state_msg) -
+           sizeof(OBJECT_Pose_Data_t) - sizeof(OBJECT_Prediction_Data_t));
+
+} /* End of OBJECT_Essentials_Length */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  OBJECT_Essentials_From_State                                       */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Copies a saved sample into the essentials layout                   */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * *  * *  * * * * */
+void OBJECT_Essentials_From_State(const rover_state *state, OBJECT_Essentials_Data_t *payload){
+
+    payload->timeStamp_sec = state->timeStamp_sec;
+    payload->timeStamp_nanoSec = state->timeStamp_nanoSec;
+    payload->class_id = state->class_id;
+    payload->confidenceScore = state->confidenceScore;
+    payload->distance = state->distance;
+    payload->orientation = state->orientation;
+    strncpy(payload->class_name, state->class_name, sizeof(payload->class_name));
+    strncpy(payload->object_id, state->object_id, sizeof(payload->object_id));
+
+} /* End of OBJECT_Essentials_From_State */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  OBJECT_Send_History_Packet                                         */
 /*                                                                            */
 /*  Purpose:                                                                  */
-/*         Publishes object complete history to software-bus                  */
+/*         Sends the filled history packet and starts the next one            */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * *  * *  * * * * */
+static void OBJECT_Send_History_Packet(bool last_packet){
+    OBJECT_History_Payload_t *payload = &OBJECT_TrackerData.object_complete_state_msg.Payload;
+
+    payload->last_packet = last_packet;
+
+    // Only the used part of 'data' goes on the bus
+    CFE_SB_SetTotalMsgLength((CFE_SB_MsgPtr_t) &OBJECT_TrackerData.object_complete_state_msg,
+                             sizeof(OBJECT_TrackerData.object_complete_state_msg) -
+                             (OBJECT_HISTORY_DATA_SIZE - payload->data_length));
+    CFE_SB_TimeStampMsg((CFE_SB_MsgPtr_t) &OBJECT_TrackerData.object_complete_state_msg);
+    CFE_SB_SendMsg((CFE_SB_MsgPtr_t) &OBJECT_TrackerData.object_complete_state_msg);
+
+    payload->packet_index++;
+    payload->sample_count = 0;
+    payload->data_length = 0;
+
+} /* End of OBJECT_Send_History_Packet */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  OBJECT_Publish_Complete_State                                      */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Publishes object complete history to software-bus. Only samples    */
+/*         after 'since_sequence' are sent, and only an empty not-modified    */
+/*         packet when the history is still at 'if_version'.                  */
 /*                                                                            */
 /* * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * *  * *  * * * * */
 // TO-DO: USE C BASED GENERICS AND MACROS TO SUPPORT MULTIPLE DATA/STRUCT TYPES
-// TO-DO: Will implement in the future
-void OBJECT_Publish_Complete_State(const OBJECT_Switch_t *Msg){
-    
-    // Publish Complete history message using 'zero_copy' by using CFE_SB_TransmitBuffer(SAMPLE_AppData.BigPktBuf, BufferHandle, true);
-    // SAMPLE_AppData.BigPktBuf = (SAMPLE_BigPkt_Buffer_t *)CFE_SB_AllocateMessageBuffer(sizeof(SAMPLE_BigPkt_t));
-    // Only publish enabled elements in master array
+void OBJECT_Publish_Complete_State(uint8 class_id, uint8 encoding, uint32 since_sequence, uint32 if_version){
+    OBJECT_History_Payload_t *payload = &OBJECT_TrackerData.object_complete_state_msg.Payload;
+    const Object_Master_Node_t *headNode;
+    OBJECT_History_Encoder_t encoder;
+    OBJECT_History_Sample_t sample;
+    OBJECT_Essentials_Data_t essentials;
+    OBJECT_Snapshot_t snapshot;
+    OBJECT_Epoch_t *domain;
+    const Object_Node_t *node;
+    uint32 total = 0;
+
+    if((class_id >= MAX_OBJECT_TRACKING) ||
+       ((encoding != OBJECT_HISTORY_ENCODING_RAW) && (encoding != OBJECT_HISTORY_ENCODING_DELTA))){
+        OBJECT_TrackerData.ErrCounter++;
 
-} /* End of OBJECT_Publish_States */
+        CFE_EVS_SendEvent(OBJECT_HISTORY_ERR_EID,
+                          CFE_EVS_EventType_ERROR,
+                          "Invalid complete history request: class %d, encoding %d",
+                          class_id,
+                          encoding);
+        return;
+    }
+
+    headNode = &OBJECT_TrackerData.object_track_listing.object_list[class_id];
+
+    payload->class_id = class_id;
+    payload->encoding = encoding;
+    payload->packet_index = 0;
+    payload->sample_count = 0;
+    payload->data_length = 0;
+    payload->not_modified = false;
+    payload->version = headNode->version;
+    payload->last_sequence = headNode->last_sequence;
+
+    // The consumer already holds this version
+    if((if_version != 0) && (if_version == headNode->version)){
+        payload->not_modified = true;
+        OBJECT_Send_History_Packet(true);
+
+        OBJECT_TrackerData.CmdCounter++;
+
+        CFE_EVS_SendEvent(OBJECT_HISTORY_INF_EID,
+                          CFE_EVS_EventType_DEBUG,
+                          "Complete history of class %d not modified since version %lu",
+                          class_id,
+                          (unsigned long) if_version);
+        return;
+    }
+
+    // Consistent view of the history, its shard may insert while it is sent
+    domain = &OBJECT_Shard_Of_Class(&OBJECT_TrackerData.Shards, class_id)->epoch;
+    if(!OBJECT_Snapshot_Begin(domain, &OBJECT_TrackerData.object_track_listing, class_id, &snapshot)){
+        OBJECT_TrackerData.ErrCounter++;
+
+        CFE_EVS_SendEvent(OBJECT_HISTORY_ERR_EID,
+                          CFE_EVS_EventType_ERROR,
+                          "Complete history of class %d refused: no free snapshot",
+                          class_id);
+        return;
+    }
+
+    OBJECT_History_Encoder_Init(&encoder, payload->data, sizeof(payload->data));
+
+    for(node = OBJECT_Snapshot_First(&snapshot, class_id);
+        node != NULL;
+        node = OBJECT_Snapshot_Next(&snapshot, node)){
+
+        // Held by the consumer already, delayed samples can still follow
+        if(node->sequence <= since_sequence){
+            continue;
+        }
+
+        if(encoding == OBJECT_HISTORY_ENCODING_DELTA){
+            OBJECT_Compact_Sample(&OBJECT_TrackerData.Compact, &node->object_state, &sample);
+
+            // Packet is full - send it and start the next one from a new base sample
+            if(!OBJECT_History_Encode(&encoder, &sample)){
+                payload->sample_count = encoder.sample_count;
+                payload->data_length = encoder.length;
+                OBJECT_Send_History_Packet(false);
+
+                OBJECT_History_Encoder_Init(&encoder, payload->data, sizeof(payload->data));
+                OBJECT_History_Encode(&encoder, &sample);
+            }
+
+            payload->sample_count = encoder.sample_count;
+            payload->data_length = encoder.length;
+        } else {
+            if((payload->data_length + sizeof(essentials)) > sizeof(payload->data)){
+                OBJECT_Send_History_Packet(false);
+            }
+
+            OBJECT_Essentials_From_State(&node->object_state, &essentials);
+            memcpy(&payload->data[payload->data_length], &essentials, sizeof(essentials));
+            payload->data_length += sizeof(essentials);
+            payload->sample_count++;
+        }
+
+        total++;
+    }
+
+    OBJECT_Snapshot_End(domain, &snapshot);
+
+    // Always closes the series, even for an empty history
+    OBJECT_Send_History_Packet(true);
+
+    OBJECT_TrackerData.CmdCounter++;
+
+    CFE_EVS_SendEvent(OBJECT_HISTORY_INF_EID,
+                      CFE_EVS_EventType_INFORMATION,
+                      "Complete history of class %d sent: %lu samples in %d packets",
+                      class_id,
+                      (unsigned long) total,
+                      payload->packet_index);
+
+} /* End of OBJECT_Publish_Complete_State */
 
 // TO-DO: If object linked-list is too long,
 // function loops over entries and checks length.
@@ -46,6 +46,70 @@
 // Needed for Object_tracking to work properly
 #include "sync_node_lib.h"
 
+// ROS2 bridge shared-memory ring reader
+#include "object_tracking_app_shm.h"
+
+// Local datagram socket reader
+#include "object_tracking_app_socket.h"
+
+// Append-only stream file reader
+#include "object_tracking_app_stream.h"
+
+// Compact essentials telemetry and track dictionary
+#include "object_tracking_app_compact.h"
+
+// Keypoint side buffers and geometry kernels
+#include "object_tracking_app_keypoints.h"
+
+// Per-track derived kinematics
+#include "object_tracking_app_kinematics.h"
+
+// History node pool and track lifecycle aging
+#include "object_tracking_app_pool.h"
+#include "object_tracking_app_lifecycle.h"
+
+// Epoch based history snapshots
+#include "object_tracking_app_epoch.h"
+
+// Latency compensating track predictions
+#include "object_tracking_app_predict.h"
+
+// Pipeline latency tracing
+#include "object_tracking_app_latency.h"
+
+// Parse workers for file ingest
+#include "object_tracking_app_parse.h"
+
+// Processed file retirement
+#include "object_tracking_app_retire.h"
+
+// Running per-class and per-track statistics
+#include "object_tracking_app_stats.h"
+
+// Per-track sliding-window aggregates
+#include "object_tracking_app_window.h"
+
+// Essentials output scheduler
+#include "object_tracking_app_sched.h"
+
+// Publish subscription filter
+#include "object_tracking_app_filter.h"
+
+// Same-frame duplicate fusion
+#include "object_tracking_app_fuse.h"
+
+// Bulk history and query request queue
+#include "object_tracking_app_bulk.h"
+
+// History export to cFE files
+#include "object_tracking_app_export.h"
+
+// Shared latest-state table
+#include "object_tracking_app_latest.h"
+
+// Class-sharded tracking tasks
+#include "object_tracking_app_shard.h"
+
 
 /***********************************************************************/
 #define OBJECT_PIPE_DEPTH                     128 /* Depth of the Command Pipe for Application */
@@ -54,6 +118,13 @@
 #define ROS2_FILE_LOC                         "/root/img_data/" 
 #define BACKUP_HISTORY                        false
 
+// Ingest transports for ROS2-YOLO detection frames
+#define OBJECT_INGEST_FILE                    0 /* One JSON file per frame in ROS2_FILE_LOC */
+#define OBJECT_INGEST_SHM_RING                1 /* POSIX shared-memory ring, see object_tracking_shm_ring.h */
+#define OBJECT_INGEST_SOCKET                  2 /* Local datagrams, see object_tracking_app_socket.h */
+#define OBJECT_INGEST_STREAM                  3 /* Append-only stream file, see object_tracking_stream.h */
+#define OBJECT_INGEST_MODE                    OBJECT_INGEST_FILE
+
 /************************************************************************
 ** Type Definitions
 *************************************************************************/
@@ -89,16 +160,95 @@ typedef struct
     // File counter
     int fileItr;
 
+    // Selected ingest transport (OBJECT_INGEST_*)
+    uint8 IngestMode;
+
+    // Shared-memory ring reader state
+    OBJECT_ShmReader_t ShmReader;
+
+    // Datagram socket reader state
+    OBJECT_SocketReader_t SocketReader;
+
+    // Stream file reader state
+    OBJECT_StreamReader_t StreamReader;
+
+    // Scratch frame the transports decode into before insertion
+    rover_array IngestRovers;
+
+    // File ingest parse workers and their frame buffers
+    OBJECT_Parse_Pool_t ParsePool;
+
+    // Deletes or archives the files ingest is done with
+    OBJECT_Retire_t Retire;
+
+    // Pipeline timestamps of the frame in 'IngestRovers', copied to its samples
+    OBJECT_Latency_Trace_t IngestTrace;
+
+    // Rolling stage latencies and the SLA check
+    OBJECT_Latency_t Latency;
+
+    // Ingest counters (reported in housekeeping)
+    uint32 IngestFrameCount;
+    uint32 IngestOverrunCount;
+    uint32 IngestMalformedCount;
+
     // Used for tracking objects based on 'class_id' and corresponding index position
     Object_Master_List_t  object_track_listing;
 
+    // Every history node, split into one sample pool per shard
+    Object_Node_t SampleNodes[OBJECT_SAMPLE_POOL_SIZE + OBJECT_SAMPLE_HEADROOM];
+
+    // Tentative/confirmed/coasting state of every track and a timer wheel per shard
+    OBJECT_Lifecycle_t Lifecycle;
+
     // Outbound essential object state message
     OBJECT_State_t object_essential_state_msg;
 
+    // Compact essentials format, track dictionary and their messages
+    OBJECT_Compact_Data_t Compact;
+
+    // Publish priorities, rate limits and the per-cycle budget
+    OBJECT_Sched_t Sched;
+
+    // Enabled classes and detection limits of the publish subscription
+    OBJECT_Filter_t Filter;
+
+    // Gate and counts of same-frame duplicate fusion
+    OBJECT_Fuse_t Fuse;
+
+    // History export task and the export it is writing
+    OBJECT_Export_t Export;
+
+    // Newest state of every track, shared read-only with local apps
+    OBJECT_Latest_t Latest;
+
+    // Tasks tracking the classes they own, with their histories and outputs
+    OBJECT_Shard_Pool_t Shards;
+
+    // Appends keypoint geometry to full format essentials
+    bool EssIncludePose;
+
+    // Appends the track's state predicted to the publish time to full format essentials
+    bool EssIncludePrediction;
+
+    // Outbound reply to OBJECT_TRACKER_PREDICT_CC
+    OBJECT_Prediction_Packet_t prediction_msg;
+
+    // Keypoints of every track
+    OBJECT_Keypoints_t Keypoints;
+
+    // Latest observation and kinematics of every track
+    OBJECT_Kinematics_Table_t Kinematics;
+
+    // Running statistics of every class and track, and their summary message
+    OBJECT_Stats_t Stats;
+
+    // Sliding-window extremes of every track, and their message
+    OBJECT_Window_t Window;
+
     // Outbound complete object state history message
-    // May switch to normal array - not sure if
-    // zero copy will work with linked lists
-    OBJECT_history_t *object_complete_state_msg;
+    // Histories are sent as a series of these packets
+    OBJECT_History_Packet_t object_complete_state_msg;
 
     /*
     ** Run Status variable used in the main processing loop
@@ -111,6 +261,12 @@ typedef struct
     CFE_SB_PipeId_t    CommandPipe;
     CFE_SB_MsgPtr_t    MsgPtr;
 
+    // App history requests, kept off the command pipe
+    CFE_SB_PipeId_t    BulkPipe;
+
+    // History and query requests waiting behind control commands
+    OBJECT_Bulk_Queue_t BulkQueue;
+
     /*
     ** Initialization data (not reported in housekeeping)...
     */
@@ -129,6 +285,9 @@ void  OBJECT_TrackerMain(void);
 int32 OBJECT_TrackerInit(void);
 void  OBJECT_ProcessCommandPacket(CFE_SB_MsgPtr_t Msg);
 void  OBJECT_ProcessGroundCommand(CFE_SB_MsgPtr_t Msg);
+void  OBJECT_ProcessBulkPacket(CFE_SB_MsgPtr_t Msg);
+void  OBJECT_Queue_Bulk(const OBJECT_Bulk_Request_t *request);
+void  OBJECT_Serve_Bulk(void);
 int32 OBJECT_ReportHousekeeping(const CCSDS_CommandPacket_t *Msg);
 int32 OBJECT_ResetCounters(const OBJECT_ResetCounters_t *Msg);
 int32 OBJECT_Process(const OBJECT_Process_t *Msg);
@@ -138,11 +297,37 @@ bool  OBJECT_VerifyCmdLength(CFE_SB_MsgPtr_t Msg, uint16 ExpectedLength);
 
 // Object specific functions
 void OBJECT_Save_States();
+void OBJECT_File_Ingest();
+void OBJECT_Frame_To_Rovers(const OBJECT_Frame_t *frame, rover_array *rovers);
+void OBJECT_Commit_Rovers(rover_array *rovers);
 void OBJECT_Switch_Request( const OBJECT_Switch_t *Msg );
+void OBJECT_Format_Request(const OBJECT_Format_t *Msg);
+void OBJECT_Priority_Request(const OBJECT_Priority_t *Msg);
+void OBJECT_Predict_Request(const OBJECT_Predict_t *Msg);
+void OBJECT_Latency_Sla_Request(const OBJECT_Latency_Sla_t *Msg);
+void OBJECT_Window_Query_Request(const OBJECT_Window_Query_t *Msg);
+void OBJECT_Window_Config_Request(const OBJECT_Window_Config_t *Msg);
+void OBJECT_Publish_Rate_Request(const OBJECT_Publish_Rate_t *Msg);
+void OBJECT_Publish_Budget_Request(const OBJECT_Publish_Budget_t *Msg);
+void OBJECT_Subscribe_Request(const OBJECT_Subscribe_t *Msg);
+void OBJECT_Fuse_Config_Request(const OBJECT_Fuse_Config_t *Msg);
+void OBJECT_Export_Request(const OBJECT_Export_History_t *Msg);
 void OBJECT_Publish_States();
-void OBJECT_Publish_Complete_States();
-int32 amortizedInsert(rover_array *rovers);
-void insertLL(Object_Node_t objectNode, rover_state insertNode);
-void appendLL(Object_Master_Node_t *headObject, rover_state newNode);
+void OBJECT_Prepare_Publish(OBJECT_Shard_t *shard);
+void OBJECT_Publish_Sample(const OBJECT_Shard_Record_t *record);
+uint16 OBJECT_Essentials_Length(void);
+void OBJECT_Publish_Complete_State(uint8 class_id, uint8 encoding, uint32 since_sequence, uint32 if_version);
+void OBJECT_Essentials_From_State(const rover_state *state, OBJECT_Essentials_Data_t *payload);
+void OBJECT_Age_Tracks(OBJECT_Shard_t *shard);
+void OBJECT_Delete_Track(uint16 track_id, uint8 class_id);
+Object_Node_t *OBJECT_Alloc_Sample(OBJECT_Shard_t *shard, uint8 class_id);
+void OBJECT_Remove_Sample(OBJECT_Shard_t *shard, Object_Master_Node_t *headNode, Object_Node_t *node);
+void OBJECT_Reclaim_Samples(OBJECT_Shard_t *shard);
+void OBJECT_Commit_Detections(OBJECT_Shard_t *shard, const OBJECT_Shard_Entry_t *const *entries, int count);
+int32 amortizedInsert(OBJECT_Shard_t *shard, const OBJECT_Shard_Entry_t *const *entries, int count);
+void OBJECT_Link_Sample(OBJECT_Shard_t *shard, Object_Node_t *newObject);
+void insertLL(Object_Master_Node_t *headObject, Object_Node_t *objectNode, Object_Node_t *newObject);
+void appendLL(Object_Master_Node_t *headObject, Object_Node_t *newObject);
+void unlinkLL(Object_Master_Node_t *headObject, Object_Node_t *objectNode);
 
 #endif /* _object_tracker_h_ */
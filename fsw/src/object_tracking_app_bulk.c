@@ -0,0 +1,103 @@
+/*******************************************************************************
+**
+**      GSC-18128-1, "Core Flight Executive Version 6.7"
+**
+**      Copyright (c) 2006-2019 United States Government as represented by
+**      the Administrator of the National Aeronautics and Space Administration.
+**      All Rights Reserved.
+**
+**      Licensed under the Apache License, Version 2.0 (the "License");
+**      you may not use this file except in compliance with the License.
+**      You may obtain a copy of the License at
+**
+**        http://www.apache.org/licenses/LICENSE-2.0
+**
+**      Unless required by applicable law or agreed to in writing, software
+**      distributed under the License is distributed on an "AS IS" BASIS,
+**      WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**      See the License for the specific language governing permissions and
+**      limitations under the License.
+**
+**
+** File: object_tracking_app_bulk.c
+**
+** Purpose:
+**   FIFO of pending bulk requests with coalescing of duplicates.
+**
+** Notes:
+**   A request equal to one still waiting is answered by that one's reply,
+**   so a burst of identical history requests costs one response. Queued
+**   requests are few, a linear scan finds duplicates.
+**
+*******************************************************************************/
+
+/*
+** Include Files:
+*/
+#include <string.h>
+
+#include "object_tracking_app_bulk.h"
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  OBJECT_Bulk_Init                                                   */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Empty queue and cleared counts                                     */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * *  * *  * * * * */
+void OBJECT_Bulk_Init(OBJECT_Bulk_Queue_t *queue){
+
+    memset(queue, 0, sizeof(*queue));
+
+} /* End of OBJECT_Bulk_Init */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  OBJECT_Bulk_Push                                                   */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Queues a request unless an equal one is already waiting            */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * *  * *  * * * * */
+uint8 OBJECT_Bulk_Push(OBJECT_Bulk_Queue_t *queue, const OBJECT_Bulk_Request_t *request){
+    uint16 itr;
+
+    for(itr = 0; itr < queue->count; itr++){
+        if(memcmp(&queue->requests[(queue->head + itr) % OBJECT_BULK_QUEUE_DEPTH],
+                  request, sizeof(*request)) == 0){
+            queue->coalesced_count++;
+            return(OBJECT_BULK_COALESCED);
+        }
+    }
+
+    if(queue->count == OBJECT_BULK_QUEUE_DEPTH){
+        queue->rejected_count++;
+        return(OBJECT_BULK_FULL);
+    }
+
+    queue->requests[(queue->head + queue->count) % OBJECT_BULK_QUEUE_DEPTH] = *request;
+    queue->count++;
+
+    return(OBJECT_BULK_QUEUED);
+
+} /* End of OBJECT_Bulk_Push */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  OBJECT_Bulk_Pop                                                    */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Takes the oldest request, false when none is waiting               */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * *  * *  * * * * */
+bool OBJECT_Bulk_Pop(OBJECT_Bulk_Queue_t *queue, OBJECT_Bulk_Request_t *request){
+
+    if(queue->count == 0){
+        return(false);
+    }
+
+    *request = queue->requests[queue->head];
+    queue->head = (queue->head + 1) % OBJECT_BULK_QUEUE_DEPTH;
+    queue->count--;
+
+    return(true);
+
+} /* End of OBJECT_Bulk_Pop */
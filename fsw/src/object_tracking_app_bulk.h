@@ -0,0 +1,82 @@
+/*******************************************************************************
+**
+**      GSC-18128-1, "Core Flight Executive Version 6.7"
+**
+**      Copyright (c) 2006-2019 United States Government as represented by
+**      the Administrator of the National Aeronautics and Space Administration.
+**      All Rights Reserved.
+**
+**      Licensed under the Apache License, Version 2.0 (the "License");
+**      you may not use this file except in compliance with the License.
+**      You may obtain a copy of the License at
+**
+**        http://www.apache.org/licenses/LICENSE-2.0
+**
+**      Unless required by applicable law or agreed to in writing, software
+**      distributed under the License is distributed on an "AS IS" BASIS,
+**      WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**      See the License for the specific language governing permissions and
+**      limitations under the License.
+**
+**
+** File: object_tracking_app_bulk.h
+**
+** Purpose:
+**   Queue of bulk history and query requests, served after control
+**   commands within a per-cycle time budget.
+**
+*******************************************************************************/
+
+#ifndef _object_tracking_app_bulk_h_
+#define _object_tracking_app_bulk_h_
+
+#include "cfe.h"
+
+#include "object_tracking_app_msg.h"
+
+#define OBJECT_BULK_PIPE_DEPTH                64
+#define OBJECT_BULK_QUEUE_DEPTH               32
+
+// Time spent serving bulk requests per cycle, at least one is served
+#define OBJECT_BULK_BUDGET_US                 20000
+
+// Kinds of bulk request
+#define OBJECT_BULK_COMPLETE                  1 /* OBJECT_Publish_Complete_State */
+#define OBJECT_BULK_PREDICT                   2 /* OBJECT_Predict_Request */
+#define OBJECT_BULK_WINDOW                    3 /* OBJECT_Window_Query_Request */
+
+// Outcome of 'OBJECT_Bulk_Push'
+#define OBJECT_BULK_QUEUED                    0
+#define OBJECT_BULK_COALESCED                 1
+#define OBJECT_BULK_FULL                      2
+
+// Arguments of every kind, unused ones zero so equal requests compare equal
+typedef struct
+{
+    uint8       kind;
+    uint8       class_id;
+    uint8       encoding;
+    uint8       spare;
+    uint16      track_id;
+    uint16      spare2;
+    uint32      seconds;
+    uint32      subseconds;
+    uint32      since_sequence;
+    uint32      if_version;
+} OBJECT_Bulk_Request_t;
+
+typedef struct
+{
+    OBJECT_Bulk_Request_t requests[OBJECT_BULK_QUEUE_DEPTH];
+    uint16      head;
+    uint16      count;
+
+    uint32      coalesced_count;
+    uint32      rejected_count;
+} OBJECT_Bulk_Queue_t;
+
+void  OBJECT_Bulk_Init(OBJECT_Bulk_Queue_t *queue);
+uint8 OBJECT_Bulk_Push(OBJECT_Bulk_Queue_t *queue, const OBJECT_Bulk_Request_t *request);
+bool  OBJECT_Bulk_Pop(OBJECT_Bulk_Queue_t *queue, OBJECT_Bulk_Request_t *request);
+
+#endif /* _object_tracking_app_bulk_h_ */
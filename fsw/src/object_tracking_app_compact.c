@@ -0,0 +1,500 @@
+/*******************************************************************************
+**
+**      GSC-18128-1, "Core Flight Executive Version 6.7"
+**
+**      Copyright (c) 2006-2019 United States Government as represented by
+**      the Administrator of the National Aeronautics and Space Administration.
+**      All Rights Reserved.
+**
+**      Licensed under the Apache License, Version 2.0 (the "License");
+**      you may not use this file except in compliance with the License.
+**      You may obtain a copy of the License at
+**
+**        http://www.apache.org/licenses/LICENSE-2.0
+**
+**      Unless required by applicable law or agreed to in writing, software
+**      distributed under the License is distributed on an "AS IS" BASIS,
+**      WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**      See the License for the specific language governing permissions and
+**      limitations under the License.
+**
+** File: object_tracking_app_compact.c
+**
+** Purpose:
+**   Packs essential object states into fixed-point batches and keeps the
+**   numeric track id dictionary the ground uses to decode them.
+**
+*******************************************************************************/
+
+/*
+** Include Files:
+*/
+#include <math.h>
+
+#include "object_tracking_app_msgids.h"
+#include "object_tracking_app_compact.h"
+#include "object_tracking_app_latency.h"
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  OBJECT_Compact_Init                                                */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Clears the dictionary, splits the track ids into one block per     */
+/*         partition and initializes the outbound messages                    */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * *  * *  * * * * */
+void OBJECT_Compact_Init(OBJECT_Compact_Data_t *compact, uint32 parts){
+    uint32 itr;
+
+    memset(compact, 0, sizeof(*compact));
+    compact->format = OBJECT_ESS_FORMAT_DEFAULT;
+
+    if(parts < 1){
+        parts = 1;
+    }
+    if(parts > OBJECT_DICT_PARTITIONS_MAX){
+        parts = OBJECT_DICT_PARTITIONS_MAX;
+    }
+    compact->part_count = parts;
+
+    // Contiguous blocks, so partitions don't share the cache lines of per-track tables
+    for(itr = 0; itr < parts; itr++){
+        compact->parts[itr].capacity = OBJECT_DICT_MAX_TRACKS / parts;
+        compact->parts[itr].first_id = (itr * compact->parts[itr].capacity) + 1;
+    }
+
+    CFE_SB_InitMsg(&compact->compact_msg,
+                   OBJECT_TRACKER_ESS_COMPACT_PUB,
+                   sizeof(compact->compact_msg),
+                   true);
+
+    CFE_SB_InitMsg(&compact->dict_msg,
+                   OBJECT_TRACKER_DICT_PUB,
+                   sizeof(compact->dict_msg),
+                   true);
+
+} /* End of OBJECT_Compact_Init */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  OBJECT_Dict_Hash                                                   */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         FNV-1a over the class id and object id                             */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * *  * *  * * * * */
+static uint32 OBJECT_Dict_Hash(uint8 class_id, const char *object_id){
+    uint32 hash = 2166136261u;
+    uint32 itr;
+
+    hash = (hash ^ class_id) * 16777619u;
+    for(itr = 0; (itr < sizeof(((OBJECT_Dict_Track_t *)0)->object_id)) && (object_id[itr] != '\0'); itr++){
+        hash = (hash ^ (uint8) object_id[itr]) * 16777619u;
+    }
+
+    return(hash);
+
+} /* End of OBJECT_Dict_Hash */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  OBJECT_Dict_Part                                                   */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Partition holding a class                                          */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * *  * *  * * * * */
+static OBJECT_Dict_Partition_t *OBJECT_Dict_Part(const OBJECT_Compact_Data_t *compact, uint8 class_id){
+
+    return((OBJECT_Dict_Partition_t *) &compact->parts[class_id % compact->part_count]);
+
+} /* End of OBJECT_Dict_Part */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  OBJECT_Dict_Find                                                   */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Probes a partition's index for a (class_id, object_id) pair.       */
+/*         Returns its track id and slot, or 0 and the slot a new entry       */
+/*         should use.                                                        */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * *  * *  * * * * */
+static uint16 OBJECT_Dict_Find(const OBJECT_Compact_Data_t *compact, const OBJECT_Dict_Partition_t *part,
+                               uint8 class_id, const char *object_id, uint32 *found_slot){
+    const OBJECT_Dict_Track_t *track;
+    uint32 slot;
+    uint32 probe;
+    uint16 track_id;
+    bool   reuse = false;
+
+    slot = OBJECT_Dict_Hash(class_id, object_id) % OBJECT_DICT_HASH_SIZE;
+    *found_slot = slot;
+
+    // Linear probing, the table is never more than half full of live ids
+    for(probe = 0; probe < OBJECT_DICT_HASH_SIZE; probe++){
+        track_id = part->hash[slot];
+
+        if(track_id == 0){
+            if(!reuse){
+                *found_slot = slot;
+            }
+            break;
+        }
+
+        if(track_id == OBJECT_DICT_TOMBSTONE){
+            // First released slot on the chain is reused for a new entry
+            if(!reuse){
+                *found_slot = slot;
+                reuse = true;
+            }
+        }
+        else{
+            track = &compact->tracks[track_id - 1];
+            if((track->class_id == class_id) &&
+               (strncmp(track->object_id, object_id, sizeof(track->object_id)) == 0)){
+                *found_slot = slot;
+                return(track_id);
+            }
+        }
+
+        slot = (slot + 1) % OBJECT_DICT_HASH_SIZE;
+    }
+
+    return(0);
+
+} /* End of OBJECT_Dict_Find */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  OBJECT_Dict_Rehash                                                 */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Rebuilds a partition's index from its live tracks once released    */
+/*         slots make up a quarter of it, keeping probe chains short          */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * *  * *  * * * * */
+static void OBJECT_Dict_Rehash(OBJECT_Compact_Data_t *compact, OBJECT_Dict_Partition_t *part){
+    OBJECT_Dict_Track_t *track;
+    uint32 slot;
+    uint16 track_id;
+
+    memset(part->hash, 0, sizeof(part->hash));
+    part->tombstone_count = 0;
+
+    for(track_id = part->first_id; track_id < (part->first_id + part->track_high); track_id++){
+        track = &compact->tracks[track_id - 1];
+        if(!track->in_use){
+            continue;
+        }
+
+        OBJECT_Dict_Find(compact, part, track->class_id, track->object_id, &slot);
+        part->hash[slot] = track_id;
+    }
+
+} /* End of OBJECT_Dict_Rehash */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  OBJECT_Dict_Track_Id                                               */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Returns the numeric track id of a detection, assigning a free id   */
+/*         of its partition the first time a (class_id, object_id) pair       */
+/*         is seen. Returns 0 once the partition is full.                     */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * *  * *  * * * * */
+uint16 OBJECT_Dict_Track_Id(OBJECT_Compact_Data_t *compact, const rover_state *state){
+    OBJECT_Dict_Partition_t *part = OBJECT_Dict_Part(compact, state->class_id);
+    OBJECT_Dict_Track_t *track;
+    uint32 slot;
+    uint16 track_id;
+
+    track_id = OBJECT_Dict_Find(compact, part, state->class_id, state->object_id, &slot);
+    if(track_id != 0){
+        return(track_id);
+    }
+
+    if(part->track_count >= part->capacity){
+        part->dict_full_count++;
+        return(0);
+    }
+
+    // New track - released ids first, then the next unused one of the block
+    if(part->free_count > 0){
+        track_id = part->free_ids[--part->free_count];
+    }
+    else{
+        track_id = part->first_id + part->track_high++;
+    }
+
+    track = &compact->tracks[track_id - 1];
+    track->in_use = true;
+    track->class_id = state->class_id;
+    strncpy(track->class_name, state->class_name, sizeof(track->class_name));
+    strncpy(track->object_id, state->object_id, sizeof(track->object_id));
+
+    if(part->hash[slot] == OBJECT_DICT_TOMBSTONE){
+        part->tombstone_count--;
+    }
+    part->hash[slot] = track_id;
+    part->track_count++;
+
+    part->dict_version++;
+    part->dict_changed = true;
+
+    return(track_id);
+
+} /* End of OBJECT_Dict_Track_Id */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  OBJECT_Dict_Lookup                                                 */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Returns the track id of a known detection without assigning one,   */
+/*         0 when the pair is not in the dictionary                           */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * *  * *  * * * * */
+uint16 OBJECT_Dict_Lookup(const OBJECT_Compact_Data_t *compact, const rover_state *state){
+    uint32 slot;
+
+    return(OBJECT_Dict_Find(compact, OBJECT_Dict_Part(compact, state->class_id),
+                            state->class_id, state->object_id, &slot));
+
+} /* End of OBJECT_Dict_Lookup */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  OBJECT_Dict_Release                                                */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Returns a deleted track's id to its partition's free list          */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * *  * *  * * * * */
+void OBJECT_Dict_Release(OBJECT_Compact_Data_t *compact, uint16 track_id){
+    OBJECT_Dict_Partition_t *part;
+    OBJECT_Dict_Track_t *track;
+    uint32 slot;
+
+    if((track_id == 0) || (track_id > OBJECT_DICT_MAX_TRACKS) || !compact->tracks[track_id - 1].in_use){
+        return;
+    }
+
+    track = &compact->tracks[track_id - 1];
+    part = OBJECT_Dict_Part(compact, track->class_id);
+
+    if(OBJECT_Dict_Find(compact, part, track->class_id, track->object_id, &slot) == track_id){
+        part->hash[slot] = OBJECT_DICT_TOMBSTONE;
+        part->tombstone_count++;
+    }
+
+    memset(track, 0, sizeof(*track));
+    part->free_ids[part->free_count++] = track_id;
+    part->track_count--;
+
+    if(part->tombstone_count > (OBJECT_DICT_HASH_SIZE / 4)){
+        OBJECT_Dict_Rehash(compact, part);
+    }
+
+    part->dict_version++;
+    part->dict_changed = true;
+
+} /* End of OBJECT_Dict_Release */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  OBJECT_Dict_Version                                                */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Dictionary version carried by the compact and dictionary           */
+/*         messages, changes with every id any partition assigns or           */
+/*         releases                                                           */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * *  * *  * * * * */
+uint16 OBJECT_Dict_Version(const OBJECT_Compact_Data_t *compact){
+    uint16 version = 0;
+    uint32 itr;
+
+    for(itr = 0; itr < compact->part_count; itr++){
+        version += compact->parts[itr].dict_version;
+    }
+
+    return(version);
+
+} /* End of OBJECT_Dict_Version */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  OBJECT_Compact_Sample                                              */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Converts a detection to the fixed-point units shared by the        */
+/*         compact essentials and the delta encoded histories                 */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * *  * *  * * * * */
+void OBJECT_Compact_Sample(const OBJECT_Compact_Data_t *compact, const rover_state *state, OBJECT_History_Sample_t *sample){
+    double value;
+
+    memset(sample, 0, sizeof(*sample));
+
+    sample->timeStamp_sec = state->timeStamp_sec;
+    sample->timeStamp_nanoSec = state->timeStamp_nanoSec;
+    sample->track_id = OBJECT_Dict_Lookup(compact, state);
+    sample->class_id = state->class_id;
+
+    // Confidence score is 0.0 - 1.0
+    value = state->confidenceScore * 100.0;
+    sample->confidence = (uint8) ((value <= 0.0) ? 0 : ((value >= 100.0) ? 100 : lround(value)));
+
+    // Distance in meters, clamped to the 32 bit millimeter range
+    value = state->distance * 1000.0;
+    sample->distance_mm = (uint32) ((value <= 0.0) ? 0 : ((value >= 4294967295.0) ? 4294967295u : llround(value)));
+
+    // Orientation in degrees, wrapped to 0 - 359.99
+    value = fmod(state->orientation, 360.0);
+    if(value < 0.0){
+        value += 360.0;
+    }
+    sample->orientation_cdeg = (uint16) (lround(value * 100.0) % 36000);
+
+} /* End of OBJECT_Compact_Sample */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  OBJECT_Compact_Add                                                 */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Appends one detection, already in fixed point, to the compact      */
+/*         packet, sending the packet first if it is full or out of time      */
+/*         range                                                              */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * *  * *  * * * * */
+void OBJECT_Compact_Add(OBJECT_Compact_Data_t *compact, const OBJECT_History_Sample_t *sample,
+                        const OBJECT_Kinematics_Data_t *kinematics){
+    OBJECT_Compact_State_Payload_t *payload = &compact->compact_msg.Payload;
+    OBJECT_Compact_Object_t *object;
+    double offset_ms = 0.0;
+
+    if(payload->object_count > 0){
+        offset_ms = (((double) sample->timeStamp_sec - (double) payload->timeStamp_sec) * 1000.0) +
+                    (((double) sample->timeStamp_nanoSec - (double) payload->timeStamp_nanoSec) / 1000000.0);
+    }
+
+    // Starts a new packet when this one is full or the offset doesn't fit
+    if((payload->object_count >= OBJECT_COMPACT_MAX_OBJECTS) ||
+       (offset_ms > 32767.0) || (offset_ms < -32768.0)){
+        OBJECT_Compact_Flush(compact);
+        offset_ms = 0.0;
+    }
+
+    if(payload->object_count == 0){
+        payload->timeStamp_sec = sample->timeStamp_sec;
+        payload->timeStamp_nanoSec = sample->timeStamp_nanoSec;
+    }
+
+    object = &payload->objects[payload->object_count++];
+
+    object->track_id = sample->track_id;
+    object->class_id = sample->class_id;
+    object->confidence = sample->confidence;
+    object->distance_mm = sample->distance_mm;
+    object->orientation_cdeg = sample->orientation_cdeg;
+    object->time_offset_ms = (int16) lround(offset_ms);
+
+    // Kinematics are optional, the sample may be older than its track's latest
+    object->range_rate_cmps = 0;
+    object->time_to_contact_ds = 0xFFFF;
+    if((kinematics != NULL) && kinematics->valid){
+        object->range_rate_cmps = (int16) fmax(-32768.0, fmin(32767.0, round(kinematics->range_rate * 100.0)));
+        if(kinematics->time_to_contact >= 0.0f){
+            object->time_to_contact_ds = (uint16) fmin(65534.0, round(kinematics->time_to_contact * 10.0));
+        }
+    }
+
+} /* End of OBJECT_Compact_Add */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  OBJECT_Compact_Flush                                               */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Sends the pending compact packet, trimmed to the used objects      */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * *  * *  * * * * */
+void OBJECT_Compact_Flush(OBJECT_Compact_Data_t *compact){
+    OBJECT_Compact_State_Payload_t *payload = &compact->compact_msg.Payload;
+
+    if(payload->object_count == 0){
+        return;
+    }
+
+    payload->dict_version = OBJECT_Dict_Version(compact);
+    payload->age_us = OBJECT_Latency_Age(payload->timeStamp_sec, payload->timeStamp_nanoSec, OBJECT_Latency_Now());
+
+    CFE_SB_SetTotalMsgLength((CFE_SB_MsgPtr_t) &compact->compact_msg,
+                             sizeof(compact->compact_msg) -
+                             ((OBJECT_COMPACT_MAX_OBJECTS - payload->object_count) * sizeof(OBJECT_Compact_Object_t)));
+    CFE_SB_TimeStampMsg((CFE_SB_MsgPtr_t) &compact->compact_msg);
+    CFE_SB_SendMsg((CFE_SB_MsgPtr_t) &compact->compact_msg);
+
+    payload->object_count = 0;
+
+} /* End of OBJECT_Compact_Flush */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  OBJECT_Dict_Publish                                                */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Called every cycle. Sends the whole dictionary, page by page,      */
+/*         every OBJECT_DICT_PUBLISH_CYCLES cycles or right after it changed  */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * *  * *  * * * * */
+void OBJECT_Dict_Publish(OBJECT_Compact_Data_t *compact){
+    OBJECT_Dict_Payload_t *payload = &compact->dict_msg.Payload;
+    OBJECT_Dict_Track_t *track;
+    uint16 track_count = 0;
+    uint16 first;
+    uint16 itr;
+
+    for(itr = 0; itr < compact->part_count; itr++){
+        if(compact->parts[itr].dict_changed){
+            compact->dict_changed = true;
+            compact->parts[itr].dict_changed = false;
+        }
+        track_count += compact->parts[itr].track_count;
+    }
+
+    if(!compact->dict_changed && (++compact->dict_cycle < OBJECT_DICT_PUBLISH_CYCLES)){
+        return;
+    }
+
+    compact->dict_changed = false;
+    compact->dict_cycle = 0;
+
+    if(track_count == 0){
+        return;
+    }
+
+    // Pages hold consecutive live entries, released and unused ids are skipped
+    itr = 0;
+    for(first = 0; first < track_count; first += payload->entry_count){
+        payload->dict_version = OBJECT_Dict_Version(compact);
+        payload->first_entry = first;
+        payload->total_entries = track_count;
+        payload->entry_count = 0;
+
+        for(; (itr < OBJECT_DICT_MAX_TRACKS) && (payload->entry_count < OBJECT_DICT_MAX_ENTRIES); itr++){
+            track = &compact->tracks[itr];
+            if(!track->in_use){
+                continue;
+            }
+
+            payload->entries[payload->entry_count].track_id = itr + 1;
+            payload->entries[payload->entry_count].class_id = track->class_id;
+            memcpy(payload->entries[payload->entry_count].class_name, track->class_name, sizeof(track->class_name));
+            memcpy(payload->entries[payload->entry_count].object_id, track->object_id, sizeof(track->object_id));
+            payload->entry_count++;
+        }
+
+        if(payload->entry_count == 0){
+            break;
+        }
+
+        CFE_SB_SetTotalMsgLength((CFE_SB_MsgPtr_t) &compact->dict_msg,
+                                 sizeof(compact->dict_msg) -
+                                 ((OBJECT_DICT_MAX_ENTRIES - payload->entry_count) * sizeof(OBJECT_Dict_Entry_t)));
+        CFE_SB_TimeStampMsg((CFE_SB_MsgPtr_t) &compact->dict_msg);
+        CFE_SB_SendMsg((CFE_SB_MsgPtr_t) &compact->dict_msg);
+    }
+
+} /* End of OBJECT_Dict_Publish */
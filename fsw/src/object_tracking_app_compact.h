@@ -0,0 +1,118 @@
+/*******************************************************************************
+**
+**      GSC-18128-1, "Core Flight Executive Version 6.7"
+**
+**      Copyright (c) 2006-2019 United States Government as represented by
+**      the Administrator of the National Aeronautics and Space Administration.
+**      All Rights Reserved.
+**
+**      Licensed under the Apache License, Version 2.0 (the "License");
+**      you may not use this file except in compliance with the License.
+**      You may obtain a copy of the License at
+**
+**        http://www.apache.org/licenses/LICENSE-2.0
+**
+**      Unless required by applicable law or agreed to in writing, software
+**      distributed under the License is distributed on an "AS IS" BASIS,
+**      WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**      See the License for the specific language governing permissions and
+**      limitations under the License.
+**
+** File: object_tracking_app_compact.h
+**
+** Purpose:
+**   Compact fixed-point essentials telemetry and the numeric track id
+**   dictionary it refers to.
+**
+*******************************************************************************/
+
+#ifndef _object_tracking_app_compact_h_
+#define _object_tracking_app_compact_h_
+
+#include "cfe.h"
+
+#include "object_tracking_app_msg.h"
+#include "object_tracking_history_codec.h"
+#include "sync_node_lib.h"
+
+// Wire format used at startup (OBJECT_ESS_FORMAT_*)
+#define OBJECT_ESS_FORMAT_DEFAULT             OBJECT_ESS_FORMAT_FULL
+
+// Maximum amount of numeric track ids, the hash table is twice as large
+#define OBJECT_DICT_MAX_TRACKS                128
+#define OBJECT_DICT_HASH_SIZE                 (OBJECT_DICT_MAX_TRACKS * 2)
+
+// Hash slot of a released track, probing continues past it
+#define OBJECT_DICT_TOMBSTONE                 0xFFFF
+
+// Dictionary partitions, one per history shard. Class 'c' is in partition
+// 'c % part_count', which hands out the track ids of its own block.
+#define OBJECT_DICT_PARTITIONS_MAX            8
+
+// Main loop cycles between two complete dictionary publications
+#define OBJECT_DICT_PUBLISH_CYCLES            20
+
+// One known (class_id, object_id) pair, its track id is its index + 1
+typedef struct
+{
+    bool        in_use;
+    uint8       class_id;
+    char        class_name[10];
+    char        object_id[10];
+} OBJECT_Dict_Track_t;
+
+// Track ids and open addressing index of one partition, only changed by
+// the shard owning its classes
+typedef struct
+{
+    // Block of track ids 'first_id' to 'first_id + capacity - 1'
+    uint16                  first_id;
+    uint16                  capacity;
+
+    // Released ids are reused before the high water mark grows
+    uint16                  track_count;
+    uint16                  track_high;
+    uint16                  free_ids[OBJECT_DICT_MAX_TRACKS];
+    uint16                  free_count;
+    uint16                  hash[OBJECT_DICT_HASH_SIZE];
+    uint16                  tombstone_count;
+
+    // Bumped whenever a track id is assigned or released
+    uint16                  dict_version;
+    bool                    dict_changed;
+
+    // Detections that got no track id because the partition was full
+    uint32                  dict_full_count;
+} OBJECT_Dict_Partition_t;
+
+typedef struct
+{
+    // Selected essentials wire format
+    uint8                   format;
+
+    // Track dictionary - indexed by track id, each partition only writes its block
+    OBJECT_Dict_Track_t     tracks[OBJECT_DICT_MAX_TRACKS];
+    OBJECT_Dict_Partition_t parts[OBJECT_DICT_PARTITIONS_MAX];
+    uint32                  part_count;
+
+    // Forces the next dictionary publication, and the cycles since the last one
+    bool                    dict_changed;
+    uint32                  dict_cycle;
+
+    // Outbound messages
+    OBJECT_Compact_State_t  compact_msg;
+    OBJECT_Dict_t           dict_msg;
+} OBJECT_Compact_Data_t;
+
+void   OBJECT_Compact_Init(OBJECT_Compact_Data_t *compact, uint32 parts);
+uint16 OBJECT_Dict_Track_Id(OBJECT_Compact_Data_t *compact, const rover_state *state);
+uint16 OBJECT_Dict_Lookup(const OBJECT_Compact_Data_t *compact, const rover_state *state);
+void   OBJECT_Dict_Release(OBJECT_Compact_Data_t *compact, uint16 track_id);
+uint16 OBJECT_Dict_Version(const OBJECT_Compact_Data_t *compact);
+void   OBJECT_Compact_Sample(const OBJECT_Compact_Data_t *compact, const rover_state *state, OBJECT_History_Sample_t *sample);
+void   OBJECT_Compact_Add(OBJECT_Compact_Data_t *compact, const OBJECT_History_Sample_t *sample,
+                          const OBJECT_Kinematics_Data_t *kinematics);
+void   OBJECT_Compact_Flush(OBJECT_Compact_Data_t *compact);
+void   OBJECT_Dict_Publish(OBJECT_Compact_Data_t *compact);
+
+#endif /* _object_tracking_app_compact_h_ */
@@ -0,0 +1,267 @@
+/*******************************************************************************
+**
+**      GSC-18128-1, "Core Flight Executive Version 6.7"
+**
+**      Copyright (c) 2006-2019 United States Government as represented by
+**      the Administrator of the National Aeronautics and Space Administration.
+**      All Rights Reserved.
+**
+**      Licensed under the Apache License, Version 2.0 (the "License");
+**      you may not use this file except in compliance with the License.
+**      You may obtain a copy of the License at
+**
+**        http://www.apache.org/licenses/LICENSE-2.0
+**
+**      Unless required by applicable law or agreed to in writing, software
+**      distributed under the License is distributed on an "AS IS" BASIS,
+**      WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**      See the License for the specific language governing permissions and
+**      limitations under the License.
+**
+**
+** File: object_tracking_app_epoch.c
+**
+** Purpose:
+**   Reader registration and node visibility for history snapshots.
+**
+** Notes:
+**   Every node records the epoch it was linked in and, once removed, the
+**   epoch it was removed in. Opening a snapshot advances the epoch, so the
+**   snapshot sees exactly the nodes born before it and not removed before
+**   it, whatever ingest does afterwards. Removed nodes stay linked until no
+**   open snapshot can see them, then stay out of the pool until no
+**   snapshot that could still be standing on them is open.
+**
+*******************************************************************************/
+
+/*
+** Include Files:
+*/
+#include "object_tracking_app_epoch.h"
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  OBJECT_Epoch_Init                                                  */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Clears the reader table and creates the link mutex                 */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * *  * *  * * * * */
+int32 OBJECT_Epoch_Init(OBJECT_Epoch_t *domain, const char *name){
+
+    memset(domain, 0, sizeof(*domain));
+    domain->epoch = 1;
+
+    return(OS_MutSemCreate(&domain->mutex_id, name, 0));
+
+} /* End of OBJECT_Epoch_Init */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  OBJECT_Epoch_Lock                                                  */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Held by ingest around link updates and by readers while opening    */
+/*         or closing a snapshot                                              */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * *  * *  * * * * */
+void OBJECT_Epoch_Lock(OBJECT_Epoch_t *domain){
+
+    OS_MutSemTake(domain->mutex_id);
+
+} /* End of OBJECT_Epoch_Lock */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  OBJECT_Epoch_Unlock                                                */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Releases the link mutex                                            */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * *  * *  * * * * */
+void OBJECT_Epoch_Unlock(OBJECT_Epoch_t *domain){
+
+    OS_MutSemGive(domain->mutex_id);
+
+} /* End of OBJECT_Epoch_Unlock */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  OBJECT_Epoch_Pinned                                                */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         True while any snapshot is open, call with the lock held           */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * *  * *  * * * * */
+bool OBJECT_Epoch_Pinned(const OBJECT_Epoch_t *domain){
+    int itr;
+
+    for(itr = 0; itr < OBJECT_EPOCH_MAX_READERS; itr++){
+        if(domain->readers[itr].active){
+            return(true);
+        }
+    }
+
+    return(false);
+
+} /* End of OBJECT_Epoch_Pinned */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  OBJECT_Epoch_Oldest                                                */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Epoch of the oldest open snapshot, the current epoch + 1 when none */
+/*         is open. Nodes removed or unlinked before it are out of every view.*/
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * *  * *  * * * * */
+uint32 OBJECT_Epoch_Oldest(const OBJECT_Epoch_t *domain){
+    uint32 oldest = domain->epoch + 1;
+    int itr;
+
+    for(itr = 0; itr < OBJECT_EPOCH_MAX_READERS; itr++){
+        if(domain->readers[itr].active && ((int32) (domain->readers[itr].epoch - oldest) < 0)){
+            oldest = domain->readers[itr].epoch;
+        }
+    }
+
+    return(oldest);
+
+} /* End of OBJECT_Epoch_Oldest */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  OBJECT_Epoch_Defer                                                 */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Appends a node to one of the deferred queues                       */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * *  * *  * * * * */
+void OBJECT_Epoch_Defer(Object_Node_t **head, Object_Node_t **tail, Object_Node_t *node){
+
+    node->retired_next = NULL;
+
+    if(*tail != NULL){
+        (*tail)->retired_next = node;
+    } else {
+        *head = node;
+    }
+    *tail = node;
+
+} /* End of OBJECT_Epoch_Defer */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  OBJECT_Snapshot_Begin                                              */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Opens a snapshot of a class history, 'domain' is the one of the    */
+/*         class's shard. Returns false when all reader slots are in use.     */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * *  * *  * * * * */
+bool OBJECT_Snapshot_Begin(OBJECT_Epoch_t *domain, const Object_Master_List_t *list,
+                           uint8 class_id, OBJECT_Snapshot_t *snap){
+    int itr;
+
+    snap->reader = -1;
+
+    OBJECT_Epoch_Lock(domain);
+
+    for(itr = 0; itr < OBJECT_EPOCH_MAX_READERS; itr++){
+        if(!domain->readers[itr].active){
+            snap->reader = itr;
+            break;
+        }
+    }
+
+    if(snap->reader < 0){
+        OBJECT_Epoch_Unlock(domain);
+        return(false);
+    }
+
+    // Everything linked from here on is tagged with the new epoch and stays invisible
+    snap->epoch = ++domain->epoch;
+    domain->readers[snap->reader].active = true;
+    domain->readers[snap->reader].epoch = snap->epoch;
+
+    snap->class_id = class_id;
+    snap->start = (class_id < MAX_OBJECT_TRACKING) ? list->object_list[class_id].start_node : NULL;
+
+    OBJECT_Epoch_Unlock(domain);
+
+    return(true);
+
+} /* End of OBJECT_Snapshot_Begin */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  OBJECT_Snapshot_Visible                                            */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         True when a node belongs to the snapshot                           */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * *  * *  * * * * */
+static bool OBJECT_Snapshot_Visible(const OBJECT_Snapshot_t *snap, const Object_Node_t *node){
+
+    if((int32) (node->born_epoch - snap->epoch) >= 0){
+        return(false);
+    }
+
+    return((node->dead_epoch == 0) || ((int32) (node->dead_epoch - snap->epoch) >= 0));
+
+} /* End of OBJECT_Snapshot_Visible */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  OBJECT_Snapshot_First                                              */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Oldest sample of the class in the snapshot, NULL if there is none  */
+/*         or the snapshot is of another class                                */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * *  * *  * * * * */
+const Object_Node_t *OBJECT_Snapshot_First(const OBJECT_Snapshot_t *snap, uint8 class_id){
+    const Object_Node_t *node;
+
+    if(class_id != snap->class_id){
+        return(NULL);
+    }
+
+    node = snap->start;
+    if((node != NULL) && !OBJECT_Snapshot_Visible(snap, node)){
+        node = OBJECT_Snapshot_Next(snap, node);
+    }
+
+    return(node);
+
+} /* End of OBJECT_Snapshot_First */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  OBJECT_Snapshot_Next                                               */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Next sample of the same class in the snapshot, NULL at the end     */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * *  * *  * * * * */
+const Object_Node_t *OBJECT_Snapshot_Next(const OBJECT_Snapshot_t *snap, const Object_Node_t *node){
+
+    do{
+        node = OBJECT_EPOCH_LOAD_ACQUIRE(&node->next_node);
+    } while((node != NULL) && !OBJECT_Snapshot_Visible(snap, node));
+
+    return(node);
+
+} /* End of OBJECT_Snapshot_Next */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  OBJECT_Snapshot_End                                                */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Closes a snapshot. Its nodes are reclaimed by the next ingest      */
+/*         cycle once no older snapshot needs them.                           */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * *  * *  * * * * */
+void OBJECT_Snapshot_End(OBJECT_Epoch_t *domain, OBJECT_Snapshot_t *snap){
+
+    if(snap->reader < 0){
+        return;
+    }
+
+    OBJECT_Epoch_Lock(domain);
+    domain->readers[snap->reader].active = false;
+    OBJECT_Epoch_Unlock(domain);
+
+    snap->reader = -1;
+
+} /* End of OBJECT_Snapshot_End */
@@ -0,0 +1,92 @@
+/*******************************************************************************
+**
+**      GSC-18128-1, "Core Flight Executive Version 6.7"
+**
+**      Copyright (c) 2006-2019 United States Government as represented by
+**      the Administrator of the National Aeronautics and Space Administration.
+**      All Rights Reserved.
+**
+**      Licensed under the Apache License, Version 2.0 (the "License");
+**      you may not use this file except in compliance with the License.
+**      You may obtain a copy of the License at
+**
+**        http://www.apache.org/licenses/LICENSE-2.0
+**
+**      Unless required by applicable law or agreed to in writing, software
+**      distributed under the License is distributed on an "AS IS" BASIS,
+**      WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**      See the License for the specific language governing permissions and
+**      limitations under the License.
+**
+**
+** File: object_tracking_app_epoch.h
+**
+** Purpose:
+**   Epoch based snapshots of the object histories, so readers can walk
+**   them while ingest keeps inserting. Every shard has its own domain
+**   covering the histories of its classes.
+**
+*******************************************************************************/
+
+#ifndef _object_tracking_app_epoch_h_
+#define _object_tracking_app_epoch_h_
+
+#include "cfe.h"
+
+#include "object_tracking_app_msg.h"
+
+// Snapshots that can be open at the same time
+#define OBJECT_EPOCH_MAX_READERS              4
+
+// Link updates readers may observe while walking without the lock
+#define OBJECT_EPOCH_LOAD_ACQUIRE(ptr)        __atomic_load_n((ptr), __ATOMIC_ACQUIRE)
+#define OBJECT_EPOCH_STORE_RELEASE(ptr, val)  __atomic_store_n((ptr), (val), __ATOMIC_RELEASE)
+
+typedef struct
+{
+    bool        active;
+    uint32      epoch;
+} OBJECT_Epoch_Reader_t;
+
+typedef struct
+{
+    // Serializes reader registration with list link updates
+    uint32                  mutex_id;
+
+    // Write epoch, tags every node birth and removal. Starts at 1, 0 means "not removed".
+    uint32                  epoch;
+
+    OBJECT_Epoch_Reader_t   readers[OBJECT_EPOCH_MAX_READERS];
+
+    // Removed nodes still visible to a reader, then unlinked nodes a reader
+    // may still stand on. Both in epoch order, chained through 'retired_next'.
+    Object_Node_t           *dead_head;
+    Object_Node_t           *dead_tail;
+    Object_Node_t           *unlinked_head;
+    Object_Node_t           *unlinked_tail;
+    uint32                  deferred_count;
+} OBJECT_Epoch_t;
+
+// A consistent read-only view of one class history
+typedef struct
+{
+    int32           reader;
+    uint32          epoch;
+    uint8           class_id;
+    Object_Node_t   *start;
+} OBJECT_Snapshot_t;
+
+int32  OBJECT_Epoch_Init(OBJECT_Epoch_t *domain, const char *name);
+void   OBJECT_Epoch_Lock(OBJECT_Epoch_t *domain);
+void   OBJECT_Epoch_Unlock(OBJECT_Epoch_t *domain);
+bool   OBJECT_Epoch_Pinned(const OBJECT_Epoch_t *domain);
+uint32 OBJECT_Epoch_Oldest(const OBJECT_Epoch_t *domain);
+void   OBJECT_Epoch_Defer(Object_Node_t **head, Object_Node_t **tail, Object_Node_t *node);
+
+bool                 OBJECT_Snapshot_Begin(OBJECT_Epoch_t *domain, const Object_Master_List_t *list,
+                                           uint8 class_id, OBJECT_Snapshot_t *snap);
+const Object_Node_t *OBJECT_Snapshot_First(const OBJECT_Snapshot_t *snap, uint8 class_id);
+const Object_Node_t *OBJECT_Snapshot_Next(const OBJECT_Snapshot_t *snap, const Object_Node_t *node);
+void                 OBJECT_Snapshot_End(OBJECT_Epoch_t *domain, OBJECT_Snapshot_t *snap);
+
+#endif /* _object_tracking_app_epoch_h_ */
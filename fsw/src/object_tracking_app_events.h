@@ -38,6 +38,37 @@
 #define OBJECT_INVALID_MSGID_ERR_EID          5
 #define OBJECT_LEN_ERR_EID                    6
 #define OBJECT_PIPE_ERR_EID                   7
+#define OBJECT_SHM_INF_EID                    8
+#define OBJECT_SHM_ERR_EID                    9
+#define OBJECT_SHM_OVERRUN_ERR_EID            10
+#define OBJECT_SOCKET_INF_EID                 11
+#define OBJECT_SOCKET_ERR_EID                 12
+#define OBJECT_FORMAT_INF_EID                 13
+#define OBJECT_FORMAT_ERR_EID                 14
+#define OBJECT_HISTORY_INF_EID                15
+#define OBJECT_HISTORY_ERR_EID                16
+#define OBJECT_TRACK_DEL_DBG_EID              17
+#define OBJECT_PRIORITY_INF_EID               18
+#define OBJECT_PRIORITY_ERR_EID               19
+#define OBJECT_PREDICT_DBG_EID                20
+#define OBJECT_PREDICT_ERR_EID                21
+#define OBJECT_LATENCY_SLA_ERR_EID            22
+#define OBJECT_LATENCY_SLA_INF_EID            23
+#define OBJECT_STREAM_INF_EID                 24
+#define OBJECT_STREAM_ERR_EID                 25
+#define OBJECT_RETIRE_ERR_EID                 26
+#define OBJECT_WINDOW_INF_EID                 27
+#define OBJECT_WINDOW_ERR_EID                 28
+#define OBJECT_WINDOW_DBG_EID                 29
+#define OBJECT_SCHED_INF_EID                  30
+#define OBJECT_SCHED_ERR_EID                  31
+#define OBJECT_SUBSCRIBE_INF_EID              32
+#define OBJECT_SUBSCRIBE_ERR_EID              33
+#define OBJECT_FUSE_INF_EID                   34
+#define OBJECT_FUSE_ERR_EID                   35
+#define OBJECT_BULK_ERR_EID                   36
+#define OBJECT_EXPORT_INF_EID                 37
+#define OBJECT_EXPORT_ERR_EID                 38
 
 #endif /* _object_tracker_events_h_ */
 
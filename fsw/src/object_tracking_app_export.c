@@ -0,0 +1,321 @@
+/*******************************************************************************
+**
+**      GSC-18128-1, "Core Flight Executive Version 6.7"
+**
+**      Copyright (c) 2006-2019 United States Government as represented by
+**      the Administrator of the National Aeronautics and Space Administration.
+**      All Rights Reserved.
+**
+**      Licensed under the Apache License, Version 2.0 (the "License");
+**      you may not use this file except in compliance with the License.
+**      You may obtain a copy of the License at
+**
+**        http://www.apache.org/licenses/LICENSE-2.0
+**
+**      Unless required by applicable law or agreed to in writing, software
+**      distributed under the License is distributed on an "AS IS" BASIS,
+**      WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**      See the License for the specific language governing permissions and
+**      limitations under the License.
+**
+**
+** File: object_tracking_app_export.c
+**
+** Purpose:
+**   Writes a snapshot of the class histories to a cFE file on a low
+**   priority child task, so large histories reach the ground through file
+**   transfer instead of the real-time bus.
+**
+** Notes:
+**   The main task records the newest sample of every class and hands the
+**   export over with the semaphore. The export task fills one chunk at a
+**   time under a snapshot of its own and closes it before writing, then
+**   resumes after the last sample written. Ingest keeps inserting while
+**   the file is written. The export header is written last, once the
+**   sample count and CRC are known.
+**
+*******************************************************************************/
+
+/*
+** Include Files:
+*/
+#include "object_tracking_app_events.h"
+#include "object_tracking_app.h"
+
+extern OBJECT_TrackerData_t OBJECT_TrackerData;
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  OBJECT_Export_Flush                                                */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Writes the buffered records and adds them to the CRC               */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * *  * *  * * * * */
+static bool OBJECT_Export_Flush(OBJECT_Export_t *exporter, int32 fd, uint32 *crc){
+
+    if(exporter->buffered == 0){
+        return(true);
+    }
+
+    if(OS_write(fd, exporter->buffer, exporter->buffered) != (int32) exporter->buffered){
+        return(false);
+    }
+
+    *crc = CFE_ES_CalculateCRC(exporter->buffer, exporter->buffered, *crc, CFE_MISSION_ES_DEFAULT_CRC);
+    exporter->buffered = 0;
+
+    return(true);
+
+} /* End of OBJECT_Export_Flush */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  OBJECT_Export_Written                                              */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         True when the sample is at or before the cursor, so an             */
+/*         earlier chunk already got to it                                    */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * *  * *  * * * * */
+static bool OBJECT_Export_Written(const OBJECT_Export_Cursor_t *cursor, const Object_Node_t *node){
+    const rover_state *state = &node->object_state;
+
+    if(!cursor->started){
+        return(false);
+    }
+
+    if(state->timeStamp_sec != cursor->timeStamp_sec){
+        return(state->timeStamp_sec < cursor->timeStamp_sec);
+    }
+
+    if(state->timeStamp_nanoSec != cursor->timeStamp_nanoSec){
+        return(state->timeStamp_nanoSec < cursor->timeStamp_nanoSec);
+    }
+
+    return((int32) (node->sequence - cursor->sequence) <= 0);
+
+} /* End of OBJECT_Export_Written */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  OBJECT_Export_Fill                                                 */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Buffers the next records of a class after the cursor, under a      */
+/*         snapshot that is closed again before returning. Sets 'done'        */
+/*         when the class is complete. False when no snapshot could be        */
+/*         opened.                                                            */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * *  * *  * * * * */
+static bool OBJECT_Export_Fill(OBJECT_Export_t *exporter, uint8 class_id, OBJECT_Export_Cursor_t *cursor,
+                               uint32 *sample_count, bool *done){
+    OBJECT_Essentials_Data_t essentials;
+    const Object_Node_t *node;
+    const rover_state *state;
+    OBJECT_Epoch_t *domain = &OBJECT_Shard_Of_Class(&OBJECT_TrackerData.Shards, class_id)->epoch;
+    int tries = 0;
+
+    while(!OBJECT_Snapshot_Begin(domain, &OBJECT_TrackerData.object_track_listing, class_id,
+                                 &exporter->snapshot)){
+        if(++tries >= OBJECT_EXPORT_SNAPSHOT_TRIES){
+            return(false);
+        }
+        OS_TaskDelay(OBJECT_EXPORT_SNAPSHOT_RETRY_MS);
+    }
+
+    *done = true;
+    for(node = OBJECT_Snapshot_First(&exporter->snapshot, class_id);
+        node != NULL;
+        node = OBJECT_Snapshot_Next(&exporter->snapshot, node)){
+        state = &node->object_state;
+
+        // Written by an earlier chunk, stored after the request or out of bounds
+        if(OBJECT_Export_Written(cursor, node) ||
+           ((int32) (node->sequence - exporter->last_sequence[class_id]) > 0) ||
+           (state->timeStamp_sec < exporter->start_sec) ||
+           ((exporter->end_sec != 0) && (state->timeStamp_sec > exporter->end_sec))){
+            continue;
+        }
+
+        if((exporter->buffered + sizeof(essentials)) > sizeof(exporter->buffer)){
+            *done = false;
+            break;
+        }
+
+        OBJECT_Essentials_From_State(state, &essentials);
+        memcpy(&exporter->buffer[exporter->buffered], &essentials, sizeof(essentials));
+        exporter->buffered += sizeof(essentials);
+        (*sample_count)++;
+
+        cursor->started = true;
+        cursor->timeStamp_sec = state->timeStamp_sec;
+        cursor->timeStamp_nanoSec = state->timeStamp_nanoSec;
+        cursor->sequence = node->sequence;
+    }
+
+    OBJECT_Snapshot_End(domain, &exporter->snapshot);
+
+    return(true);
+
+} /* End of OBJECT_Export_Fill */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  OBJECT_Export_Write                                                */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Writes the handed over export, false on a file error               */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * *  * *  * * * * */
+static bool OBJECT_Export_Write(OBJECT_Export_t *exporter, int32 fd){
+    OBJECT_Export_File_Header_t header;
+    OBJECT_Export_Cursor_t cursor;
+    CFE_FS_Header_t fsHeader;
+    bool  done;
+    uint8 first = exporter->class_id;
+    uint8 last = exporter->class_id;
+    uint8 class_id;
+
+    CFE_FS_InitHeader(&fsHeader, "Object tracker history", OBJECT_EXPORT_FS_SUBTYPE);
+    if(CFE_FS_WriteHeader(fd, &fsHeader) != sizeof(fsHeader)){
+        return(false);
+    }
+
+    // Placeholder until the count and CRC are known
+    memset(&header, 0, sizeof(header));
+    header.class_id = exporter->class_id;
+    header.record_size = sizeof(OBJECT_Essentials_Data_t);
+    header.start_sec = exporter->start_sec;
+    header.end_sec = exporter->end_sec;
+    if(OS_write(fd, &header, sizeof(header)) != sizeof(header)){
+        return(false);
+    }
+
+    if(exporter->class_id == OBJECT_PREDICT_ALL_CLASSES){
+        first = 0;
+        last = MAX_OBJECT_TRACKING - 1;
+    }
+
+    exporter->buffered = 0;
+    for(class_id = first; class_id <= last; class_id++){
+        memset(&cursor, 0, sizeof(cursor));
+
+        // The snapshot is only held while a chunk is filled, never during the write
+        do{
+            if(!OBJECT_Export_Fill(exporter, class_id, &cursor, &header.sample_count, &done) ||
+               !OBJECT_Export_Flush(exporter, fd, &header.crc)){
+                return(false);
+            }
+        } while(!done);
+    }
+
+    if((OS_lseek(fd, sizeof(fsHeader), OS_SEEK_SET) != sizeof(fsHeader)) ||
+       (OS_write(fd, &header, sizeof(header)) != sizeof(header))){
+        return(false);
+    }
+
+    CFE_EVS_SendEvent(OBJECT_EXPORT_INF_EID,
+                      CFE_EVS_EventType_INFORMATION,
+                      "History export to %s complete: %lu samples, CRC 0x%08lX",
+                      exporter->filename,
+                      (unsigned long) header.sample_count,
+                      (unsigned long) header.crc);
+
+    return(true);
+
+} /* End of OBJECT_Export_Write */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  OBJECT_Export_Task                                                 */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Export task entry point. Writes each export handed over by         */
+/*         OBJECT_Export_Start.                                               */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * *  * *  * * * * */
+static void OBJECT_Export_Task(void){
+    OBJECT_Export_t *exporter = &OBJECT_TrackerData.Export;
+    int32 fd;
+
+    if(CFE_ES_RegisterChildTask() != CFE_SUCCESS){
+        return;
+    }
+
+    while(OS_BinSemTake(exporter->wake_sem_id) == OS_SUCCESS){
+        fd = OS_creat(exporter->filename, OS_WRITE_ONLY);
+
+        if((fd < 0) || !OBJECT_Export_Write(exporter, fd)){
+            exporter->error_count++;
+
+            CFE_EVS_SendEvent(OBJECT_EXPORT_ERR_EID,
+                              CFE_EVS_EventType_ERROR,
+                              "History export to %s failed, RC = %ld",
+                              exporter->filename,
+                              (long) fd);
+        } else {
+            exporter->export_count++;
+        }
+
+        if(fd >= 0){
+            OS_close(fd);
+        }
+
+        OBJECT_EPOCH_STORE_RELEASE(&exporter->busy, 0);
+    }
+
+    CFE_ES_ExitChildTask();
+
+} /* End of OBJECT_Export_Task */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  OBJECT_Export_Init                                                 */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Starts the export task                                             */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * *  * *  * * * * */
+int32 OBJECT_Export_Init(OBJECT_Export_t *exporter){
+    int32 status;
+
+    memset(exporter, 0, sizeof(*exporter));
+    exporter->snapshot.reader = -1;
+
+    status = OS_BinSemCreate(&exporter->wake_sem_id, "OBJECT_EXPORT_SEM", 0, 0);
+    if(status != OS_SUCCESS){
+        return(status);
+    }
+
+    return(CFE_ES_CreateChildTask(&exporter->task_id,
+                                  "OBJECT_EXPORT",
+                                  OBJECT_Export_Task,
+                                  NULL,
+                                  OBJECT_EXPORT_TASK_STACK,
+                                  OBJECT_EXPORT_TASK_PRIORITY,
+                                  0));
+
+} /* End of OBJECT_Export_Init */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  OBJECT_Export_Busy                                                 */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         True while an export is being written                              */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * *  * *  * * * * */
+bool OBJECT_Export_Busy(const OBJECT_Export_t *exporter){
+
+    return(OBJECT_EPOCH_LOAD_ACQUIRE(&exporter->busy) != 0);
+
+} /* End of OBJECT_Export_Busy */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  OBJECT_Export_Start                                                */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Hands the export in 'exporter' to the export task. The caller      */
+/*         has filled in the request.                                         */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * *  * *  * * * * */
+void OBJECT_Export_Start(OBJECT_Export_t *exporter){
+
+    OBJECT_EPOCH_STORE_RELEASE(&exporter->busy, 1);
+    OS_BinSemGive(exporter->wake_sem_id);
+
+} /* End of OBJECT_Export_Start */
@@ -0,0 +1,117 @@
+/*******************************************************************************
+**
+**      GSC-18128-1, "Core Flight Executive Version 6.7"
+**
+**      Copyright (c) 2006-2019 United States Government as represented by
+**      the Administrator of the National Aeronautics and Space Administration.
+**      All Rights Reserved.
+**
+**      Licensed under the Apache License, Version 2.0 (the "License");
+**      you may not use this file except in compliance with the License.
+**      You may obtain a copy of the License at
+**
+**        http://www.apache.org/licenses/LICENSE-2.0
+**
+**      Unless required by applicable law or agreed to in writing, software
+**      distributed under the License is distributed on an "AS IS" BASIS,
+**      WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**      See the License for the specific language governing permissions and
+**      limitations under the License.
+**
+**
+** File: object_tracking_app_export.h
+**
+** Purpose:
+**   History export to a cFE file, written on a child task.
+**
+** Notes:
+**   File layout: a CFE_FS_Header_t with subtype OBJECT_EXPORT_FS_SUBTYPE,
+**   an OBJECT_Export_File_Header_t, then 'sample_count' records of
+**   OBJECT_Essentials_Data_t in class order, oldest first within a class.
+**   'crc' is CFE_ES_CalculateCRC (CFE_MISSION_ES_DEFAULT_CRC) over the
+**   records.
+**
+**   Every chunk is filled under its own short snapshot, which is closed
+**   before the chunk is written, so a slow file system never keeps evicted
+**   samples pinned. Samples stored after the request are left out, samples
+**   evicted before their chunk was filled are missing from the file.
+**
+*******************************************************************************/
+
+#ifndef _object_tracking_app_export_h_
+#define _object_tracking_app_export_h_
+
+#include "cfe.h"
+
+#include "object_tracking_app_msg.h"
+#include "object_tracking_app_epoch.h"
+
+#define OBJECT_EXPORT_FS_SUBTYPE              0x4F544858 /* "OTHX" */
+
+// Records are written this many bytes at a time
+#define OBJECT_EXPORT_CHUNK                   4096
+
+// Attempts to get a snapshot for a chunk, and the delay between them
+#define OBJECT_EXPORT_SNAPSHOT_TRIES          10
+#define OBJECT_EXPORT_SNAPSHOT_RETRY_MS       10
+
+#define OBJECT_EXPORT_TASK_STACK              16384
+#define OBJECT_EXPORT_TASK_PRIORITY           200
+
+typedef struct
+{
+    // Class exported, or OBJECT_PREDICT_ALL_CLASSES
+    uint8       class_id;
+    uint8       spare;
+
+    // sizeof(OBJECT_Essentials_Data_t), so readers can check the layout
+    uint16      record_size;
+
+    uint32      start_sec;
+    uint32      end_sec;
+    uint32      sample_count;
+    uint32      crc;
+} OBJECT_Export_File_Header_t;
+
+// Last sample of a class written so far, histories are ordered by time then sequence
+typedef struct
+{
+    bool        started;
+    uint32      timeStamp_sec;
+    uint32      timeStamp_nanoSec;
+    uint32      sequence;
+} OBJECT_Export_Cursor_t;
+
+typedef struct
+{
+    uint32              task_id;
+    uint32              wake_sem_id;
+
+    // Set by the main task when it hands over an export, cleared by the export task
+    uint32              busy;
+
+    // The export handed over, owned by the export task while 'busy'
+    char                filename[OS_MAX_PATH_LEN];
+    uint8               class_id;
+    uint32              start_sec;
+    uint32              end_sec;
+
+    // Newest sample of each class when the export was requested
+    uint32              last_sequence[MAX_OBJECT_TRACKING];
+
+    // Open while a chunk is filled
+    OBJECT_Snapshot_t   snapshot;
+
+    uint8               buffer[OBJECT_EXPORT_CHUNK];
+    uint32              buffered;
+
+    // Written by the export task, reported in housekeeping
+    uint32              export_count;
+    uint32              error_count;
+} OBJECT_Export_t;
+
+int32 OBJECT_Export_Init(OBJECT_Export_t *exporter);
+bool  OBJECT_Export_Busy(const OBJECT_Export_t *exporter);
+void  OBJECT_Export_Start(OBJECT_Export_t *exporter);
+
+#endif /* _object_tracking_app_export_h_ */
@@ -0,0 +1,112 @@
+/*******************************************************************************
+**
+**      GSC-18128-1, "Core Flight Executive Version 6.7"
+**
+**      Copyright (c) 2006-2019 United States Government as represented by
+**      the Administrator of the National Aeronautics and Space Administration.
+**      All Rights Reserved.
+**
+**      Licensed under the Apache License, Version 2.0 (the "License");
+**      you may not use this file except in compliance with the License.
+**      You may obtain a copy of the License at
+**
+**        http://www.apache.org/licenses/LICENSE-2.0
+**
+**      Unless required by applicable law or agreed to in writing, software
+**      distributed under the License is distributed on an "AS IS" BASIS,
+**      WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**      See the License for the specific language governing permissions and
+**      limitations under the License.
+**
+**
+** File: object_tracking_app_filter.c
+**
+** Purpose:
+**   Decides which detections the subscription lets onto the bus.
+**
+** Notes:
+**   The class mask mirrors the per-class 'enable_switch' flags, which
+**   stay the fast per-class check in 'OBJECT_Publish_States'. The
+**   confidence and distance limits are checked per sample before it is
+**   counted against the output budget, so filtered detections cost
+**   neither messages nor budget.
+**
+*******************************************************************************/
+
+/*
+** Include Files:
+*/
+#include "object_tracking_app_filter.h"
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  OBJECT_Filter_Init                                                 */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         No class enabled, like the switches, and no detection limits       */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * *  * *  * * * * */
+void OBJECT_Filter_Init(OBJECT_Filter_t *filter){
+
+    memset(filter, 0, sizeof(*filter));
+
+} /* End of OBJECT_Filter_Init */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  OBJECT_Filter_Set_Class                                            */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Enables or disables one class in the mask                          */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * *  * *  * * * * */
+void OBJECT_Filter_Set_Class(OBJECT_Filter_t *filter, uint8 class_id, bool enable){
+    uint32 bit = 1U << (class_id % 32);
+
+    if(enable){
+        filter->class_mask[class_id / 32] |= bit;
+    } else {
+        filter->class_mask[class_id / 32] &= ~bit;
+    }
+
+} /* End of OBJECT_Filter_Set_Class */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  OBJECT_Filter_Class                                                */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         True when the class is enabled in the mask                         */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * *  * *  * * * * */
+bool OBJECT_Filter_Class(const OBJECT_Filter_t *filter, uint8 class_id){
+
+    return((filter->class_mask[class_id / 32] & (1U << (class_id % 32))) != 0);
+
+} /* End of OBJECT_Filter_Class */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  OBJECT_Filter_Match                                                */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         True when the detection meets the subscription                     */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * *  * *  * * * * */
+bool OBJECT_Filter_Match(const OBJECT_Filter_t *filter, const rover_state *state){
+
+    if(!OBJECT_Filter_Class(filter, state->class_id)){
+        return(false);
+    }
+
+    if(state->confidenceScore < filter->min_confidence){
+        return(false);
+    }
+
+    if(state->distance < filter->min_distance){
+        return(false);
+    }
+
+    if((filter->max_distance != 0.0) && (state->distance > filter->max_distance)){
+        return(false);
+    }
+
+    return(true);
+
+} /* End of OBJECT_Filter_Match */
@@ -0,0 +1,54 @@
+/*******************************************************************************
+**
+**      GSC-18128-1, "Core Flight Executive Version 6.7"
+**
+**      Copyright (c) 2006-2019 United States Government as represented by
+**      the Administrator of the National Aeronautics and Space Administration.
+**      All Rights Reserved.
+**
+**      Licensed under the Apache License, Version 2.0 (the "License");
+**      you may not use this file except in compliance with the License.
+**      You may obtain a copy of the License at
+**
+**        http://www.apache.org/licenses/LICENSE-2.0
+**
+**      Unless required by applicable law or agreed to in writing, software
+**      distributed under the License is distributed on an "AS IS" BASIS,
+**      WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**      See the License for the specific language governing permissions and
+**      limitations under the License.
+**
+**
+** File: object_tracking_app_filter.h
+**
+** Purpose:
+**   Publish subscription: the enabled classes and the confidence and
+**   distance limits a detection must meet to be published.
+**
+*******************************************************************************/
+
+#ifndef _object_tracking_app_filter_h_
+#define _object_tracking_app_filter_h_
+
+#include "cfe.h"
+
+#include "object_tracking_app_msg.h"
+
+typedef struct
+{
+    uint32      class_mask[OBJECT_SUBSCRIBE_MASK_WORDS];
+    double      min_confidence;
+    double      min_distance;
+
+    // 0 for no upper limit
+    double      max_distance;
+
+    uint32      filtered_count;
+} OBJECT_Filter_t;
+
+void OBJECT_Filter_Init(OBJECT_Filter_t *filter);
+void OBJECT_Filter_Set_Class(OBJECT_Filter_t *filter, uint8 class_id, bool enable);
+bool OBJECT_Filter_Class(const OBJECT_Filter_t *filter, uint8 class_id);
+bool OBJECT_Filter_Match(const OBJECT_Filter_t *filter, const rover_state *state);
+
+#endif /* _object_tracking_app_filter_h_ */
@@ -0,0 +1,178 @@
+/*******************************************************************************
+**
+**      GSC-18128-1, "Core Flight Executive Version 6.7"
+**
+**      Copyright (c) 2006-2019 United States Government as represented by
+**      the Administrator of the National Aeronautics and Space Administration.
+**      All Rights Reserved.
+**
+**      Licensed under the Apache License, Version 2.0 (the "License");
+**      you may not use this file except in compliance with the License.
+**      You may obtain a copy of the License at
+**
+**        http://www.apache.org/licenses/LICENSE-2.0
+**
+**      Unless required by applicable law or agreed to in writing, software
+**      distributed under the License is distributed on an "AS IS" BASIS,
+**      WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**      See the License for the specific language governing permissions and
+**      limitations under the License.
+**
+**
+** File: object_tracking_app_fuse.c
+**
+** Purpose:
+**   Merges duplicate detections of a frame before they are stored.
+**
+** Notes:
+**   Two detections are duplicates when they share class, timestamp and,
+**   if both carry one, object id, and lie within the distance and
+**   orientation gates. Each detection is compared against the group
+**   seeds found so far, which is quadratic in the detections of a frame
+**   but a frame holds few. The most confident member seeds its group and
+**   keeps its name, id and keypoints; distance and orientation become the
+**   confidence-weighted means of the group, and the confidence that of
+**   the most confident member, so fusion never makes a track look surer.
+**
+*******************************************************************************/
+
+/*
+** Include Files:
+*/
+#include <math.h>
+#include <string.h>
+
+#include "object_tracking_app_fuse.h"
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  OBJECT_Fuse_Init                                                   */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Fusion on with the default gate                                    */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * *  * *  * * * * */
+void OBJECT_Fuse_Init(OBJECT_Fuse_t *fuse){
+
+    memset(fuse, 0, sizeof(*fuse));
+    fuse->distance_gate = OBJECT_FUSE_DISTANCE_GATE_DEFAULT;
+    fuse->orientation_gate = OBJECT_FUSE_ORIENTATION_GATE_DEFAULT;
+
+} /* End of OBJECT_Fuse_Init */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  OBJECT_Fuse_Angle                                                  */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Signed difference a - b in degrees, wrapped to [-180, 180)         */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * *  * *  * * * * */
+static double OBJECT_Fuse_Angle(double a, double b){
+    double delta = fmod(a - b + 180.0, 360.0);
+
+    if(delta < 0.0){
+        delta += 360.0;
+    }
+
+    return(delta - 180.0);
+
+} /* End of OBJECT_Fuse_Angle */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  OBJECT_Fuse_Gate                                                   */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         True when two detections are the same object seen twice            */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * *  * *  * * * * */
+static bool OBJECT_Fuse_Gate(const OBJECT_Fuse_t *fuse, const rover_state *a, const rover_state *b){
+
+    if((a->class_id != b->class_id) ||
+       (a->timeStamp_sec != b->timeStamp_sec) || (a->timeStamp_nanoSec != b->timeStamp_nanoSec)){
+        return(false);
+    }
+
+    if((a->object_id[0] != '\0') && (b->object_id[0] != '\0') &&
+       (strncmp(a->object_id, b->object_id, sizeof(a->object_id)) != 0)){
+        return(false);
+    }
+
+    return((fabs(a->distance - b->distance) <= fuse->distance_gate) &&
+           (fabs(OBJECT_Fuse_Angle(a->orientation, b->orientation)) <= fuse->orientation_gate));
+
+} /* End of OBJECT_Fuse_Gate */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  OBJECT_Fuse_Frame                                                  */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Merges the duplicates of 'rovers' in place, keeping the order      */
+/*         of the group seeds                                                 */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * *  * *  * * * * */
+void OBJECT_Fuse_Frame(OBJECT_Fuse_t *fuse, rover_array *rovers){
+    rover_state *state;
+    rover_state *seed;
+    double weight[sizeof(rovers->rovers_array) / sizeof(rovers->rovers_array[0])];
+    double distance[sizeof(rovers->rovers_array) / sizeof(rovers->rovers_array[0])];
+    double offset[sizeof(rovers->rovers_array) / sizeof(rovers->rovers_array[0])];
+    double w;
+    int groups = 0;
+    int itr;
+    int grp;
+
+    if((fuse->distance_gate <= 0.0) || (rovers->arrayLen < 2)){
+        return;
+    }
+
+    for(itr = 0; itr < rovers->arrayLen; itr++){
+        state = &rovers->rovers_array[itr];
+
+        for(grp = 0; grp < groups; grp++){
+            if(OBJECT_Fuse_Gate(fuse, &rovers->rovers_array[grp], state)){
+                break;
+            }
+        }
+
+        // A zero confidence still counts, once
+        w = (state->confidenceScore > 0.0) ? state->confidenceScore : 1e-6;
+
+        if(grp == groups){
+            // New group, compacted to the front
+            rovers->rovers_array[groups] = *state;
+            weight[groups] = w;
+            distance[groups] = w * state->distance;
+            offset[groups] = 0.0;
+            groups++;
+            continue;
+        }
+
+        seed = &rovers->rovers_array[grp];
+        weight[grp] += w;
+        distance[grp] += w * state->distance;
+
+        // Orientation is averaged as offsets from the seed, so 359 and 1 meet at 0
+        offset[grp] += w * OBJECT_Fuse_Angle(state->orientation, seed->orientation);
+
+        // The most confident member becomes the seed, offsets follow it
+        if(state->confidenceScore > seed->confidenceScore){
+            offset[grp] -= weight[grp] * OBJECT_Fuse_Angle(state->orientation, seed->orientation);
+            *seed = *state;
+        }
+
+        fuse->fused_count++;
+    }
+
+    for(grp = 0; grp < groups; grp++){
+        seed = &rovers->rovers_array[grp];
+        seed->distance = distance[grp] / weight[grp];
+        seed->orientation = fmod(seed->orientation + (offset[grp] / weight[grp]), 360.0);
+
+        // Same [0, 360) range as the compact encoding
+        if(seed->orientation < 0.0){
+            seed->orientation += 360.0;
+        }
+    }
+
+    rovers->arrayLen = groups;
+
+} /* End of OBJECT_Fuse_Frame */
@@ -0,0 +1,53 @@
+/*******************************************************************************
+**
+**      GSC-18128-1, "Core Flight Executive Version 6.7"
+**
+**      Copyright (c) 2006-2019 United States Government as represented by
+**      the Administrator of the National Aeronautics and Space Administration.
+**      All Rights Reserved.
+**
+**      Licensed under the Apache License, Version 2.0 (the "License");
+**      you may not use this file except in compliance with the License.
+**      You may obtain a copy of the License at
+**
+**        http://www.apache.org/licenses/LICENSE-2.0
+**
+**      Unless required by applicable law or agreed to in writing, software
+**      distributed under the License is distributed on an "AS IS" BASIS,
+**      WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**      See the License for the specific language governing permissions and
+**      limitations under the License.
+**
+**
+** File: object_tracking_app_fuse.h
+**
+** Purpose:
+**   Ingest stage that merges overlapping same-frame detections of one
+**   object into a single confidence-weighted sample.
+**
+*******************************************************************************/
+
+#ifndef _object_tracking_app_fuse_h_
+#define _object_tracking_app_fuse_h_
+
+#include "cfe.h"
+
+#include "object_tracking_app_msg.h"
+
+// Gate at startup, meters and degrees
+#define OBJECT_FUSE_DISTANCE_GATE_DEFAULT     0.25
+#define OBJECT_FUSE_ORIENTATION_GATE_DEFAULT  3.0
+
+typedef struct
+{
+    // 0 turns fusion off
+    double      distance_gate;
+    double      orientation_gate;
+
+    uint32      fused_count;
+} OBJECT_Fuse_t;
+
+void OBJECT_Fuse_Init(OBJECT_Fuse_t *fuse);
+void OBJECT_Fuse_Frame(OBJECT_Fuse_t *fuse, rover_array *rovers);
+
+#endif /* _object_tracking_app_fuse_h_ */
@@ -0,0 +1,181 @@
+/*******************************************************************************
+**
+**      GSC-18128-1, "Core Flight Executive Version 6.7"
+**
+**      Copyright (c) 2006-2019 United States Government as represented by
+**      the Administrator of the National Aeronautics and Space Administration.
+**      All Rights Reserved.
+**
+**      Licensed under the Apache License, Version 2.0 (the "License");
+**      you may not use this file except in compliance with the License.
+**      You may obtain a copy of the License at
+**
+**        http://www.apache.org/licenses/LICENSE-2.0
+**
+**      Unless required by applicable law or agreed to in writing, software
+**      distributed under the License is distributed on an "AS IS" BASIS,
+**      WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**      See the License for the specific language governing permissions and
+**      limitations under the License.
+**
+**
+** File: object_tracking_app_history.h
+**
+** Purpose:
+**   Macro generated, type specialized ring histories.
+**
+** Notes:
+**   OBJECT_HISTORY_DEFINE(name, type, capacity, key_fn) expands to the
+**   history type 'name_t' and static inline operations specialized for
+**   'type': no void pointers, element sizes and ring masks are compile-time
+**   constants. 'capacity' must be a power of two. 'key_fn' returns the
+**   uint64 ordering key (normally OBJECT_HISTORY_TIME_KEY of the sample
+**   timestamp) of a 'const type *'.
+**
+**     name_Init(h)                  empties the history
+**     name_Count(h)                 samples stored
+**     name_At(h, i)                 i-th oldest sample, 0 is the oldest
+**     name_Newest(h)                newest sample, NULL when empty
+**     name_Append(h, item)          stores after the newest, drops the oldest when full
+**     name_Insert(h, item)          stores in key order, shifting newer samples up
+**     name_Lower_Bound(h, key)      index of the first sample with a key >= 'key'
+**     name_Range(h, begin, end, &i) samples with 'begin' <= key < 'end', from index i
+**     name_Find(h, key)             sample with exactly 'key' (key ordered histories)
+**     name_Find_Newest(h, key)      same, newest first, for arrival ordered histories
+**
+**   OBJECT_HISTORY_FOREACH(name, h, i, ptr) walks the samples oldest first.
+**
+*******************************************************************************/
+
+#ifndef _object_tracking_app_history_h_
+#define _object_tracking_app_history_h_
+
+#include "common_types.h"
+
+// Orders samples by their 'timeStamp_sec'/'timeStamp_nanoSec'
+#define OBJECT_HISTORY_TIME_KEY(sec, nanoSec)  (((uint64) (sec) * 1000000000ULL) + (uint64) (nanoSec))
+
+#define OBJECT_HISTORY_FOREACH(name, h, i, ptr) \
+    for((i) = 0; ((i) < name##_Count(h)) && (((ptr) = name##_At((h), (i))) != NULL); (i)++)
+
+#define OBJECT_HISTORY_DEFINE(name, type, capacity, key_fn)                                      \
+                                                                                                 \
+typedef char name##_Capacity_Check_t[(((capacity) & ((capacity) - 1)) == 0) ? 1 : -1];          \
+                                                                                                 \
+typedef struct                                                                                   \
+{                                                                                                \
+    type        items[capacity];                                                                 \
+                                                                                                 \
+    /* Samples ever stored, the newest is in slot ((head - 1) % capacity) */                     \
+    uint32      head;                                                                            \
+    uint32      count;                                                                           \
+} name##_t;                                                                                      \
+                                                                                                 \
+static inline void name##_Init(name##_t *h){                                                     \
+    h->head = 0;                                                                                 \
+    h->count = 0;                                                                                \
+}                                                                                                \
+                                                                                                 \
+static inline uint32 name##_Count(const name##_t *h){                                            \
+    return(h->count);                                                                            \
+}                                                                                                \
+                                                                                                 \
+static inline uint32 name##_Slot(const name##_t *h, uint32 i){                                   \
+    return((h->head - h->count + i) & ((capacity) - 1));                                         \
+}                                                                                                \
+                                                                                                 \
+static inline type *name##_At(name##_t *h, uint32 i){                                            \
+    return(&h->items[name##_Slot(h, i)]);                                                        \
+}                                                                                                \
+                                                                                                 \
+static inline const type *name##_Get(const name##_t *h, uint32 i){                               \
+    return(&h->items[name##_Slot(h, i)]);                                                        \
+}                                                                                                \
+                                                                                                 \
+static inline type *name##_Newest(name##_t *h){                                                  \
+    return((h->count == 0) ? NULL : &h->items[(h->head - 1) & ((capacity) - 1)]);                \
+}                                                                                                \
+                                                                                                 \
+static inline type *name##_Append(name##_t *h, const type *item){                                \
+    type *slot = &h->items[h->head & ((capacity) - 1)];                                          \
+                                                                                                 \
+    *slot = *item;                                                                               \
+    h->head++;                                                                                   \
+    if(h->count < (capacity)){                                                                   \
+        h->count++;                                                                              \
+    }                                                                                            \
+                                                                                                 \
+    return(slot);                                                                                \
+}                                                                                                \
+                                                                                                 \
+/* Returns NULL when the history is full and 'item' is older than all of it */                   \
+static inline type *name##_Insert(name##_t *h, const type *item){                                \
+    uint64 key = key_fn(item);                                                                   \
+    uint32 pos;                                                                                  \
+                                                                                                 \
+    /* Samples nearly always arrive in order */                                                  \
+    if((h->count == 0) || (key >= key_fn(name##_Get(h, h->count - 1)))){                         \
+        return(name##_Append(h, item));                                                          \
+    }                                                                                            \
+                                                                                                 \
+    if(h->count == (capacity)){                                                                  \
+        if(key < key_fn(name##_Get(h, 0))){                                                      \
+            return(NULL);                                                                        \
+        }                                                                                        \
+        /* The oldest slot becomes the one freed by shifting */                                  \
+        h->count--;                                                                              \
+    }                                                                                            \
+                                                                                                 \
+    for(pos = h->count; (pos > 0) && (key_fn(name##_Get(h, pos - 1)) > key); pos--){             \
+        *name##_At(h, pos) = *name##_Get(h, pos - 1);                                            \
+    }                                                                                            \
+                                                                                                 \
+    *name##_At(h, pos) = *item;                                                                  \
+    h->head++;                                                                                   \
+    h->count++;                                                                                  \
+                                                                                                 \
+    return(name##_At(h, pos));                                                                   \
+}                                                                                                \
+                                                                                                 \
+static inline uint32 name##_Lower_Bound(const name##_t *h, uint64 key){                          \
+    uint32 low = 0;                                                                              \
+    uint32 high = h->count;                                                                      \
+    uint32 mid;                                                                                  \
+                                                                                                 \
+    while(low < high){                                                                           \
+        mid = low + ((high - low) / 2);                                                          \
+        if(key_fn(name##_Get(h, mid)) < key){                                                    \
+            low = mid + 1;                                                                       \
+        } else {                                                                                 \
+            high = mid;                                                                          \
+        }                                                                                        \
+    }                                                                                            \
+                                                                                                 \
+    return(low);                                                                                 \
+}                                                                                                \
+                                                                                                 \
+static inline uint32 name##_Range(const name##_t *h, uint64 begin, uint64 end, uint32 *first){   \
+    *first = name##_Lower_Bound(h, begin);                                                       \
+                                                                                                 \
+    return((end > begin) ? (name##_Lower_Bound(h, end) - *first) : 0);                           \
+}                                                                                                \
+                                                                                                 \
+static inline const type *name##_Find(const name##_t *h, uint64 key){                            \
+    uint32 i = name##_Lower_Bound(h, key);                                                       \
+                                                                                                 \
+    return(((i < h->count) && (key_fn(name##_Get(h, i)) == key)) ? name##_Get(h, i) : NULL);     \
+}                                                                                                \
+                                                                                                 \
+static inline const type *name##_Find_Newest(const name##_t *h, uint64 key){                     \
+    uint32 i;                                                                                    \
+                                                                                                 \
+    for(i = h->count; i > 0; i--){                                                               \
+        if(key_fn(name##_Get(h, i - 1)) == key){                                                 \
+            return(name##_Get(h, i - 1));                                                        \
+        }                                                                                        \
+    }                                                                                            \
+                                                                                                 \
+    return(NULL);                                                                                \
+}
+
+#endif /* _object_tracking_app_history_h_ */
@@ -0,0 +1,259 @@
+/*******************************************************************************
+**
+**      GSC-18128-1, "Core Flight Executive Version 6.7"
+**
+**      Copyright (c) 2006-2019 United States Government as represented by
+**      the Administrator of the National Aeronautics and Space Administration.
+**      All Rights Reserved.
+**
+**      Licensed under the Apache License, Version 2.0 (the "License");
+**      you may not use this file except in compliance with the License.
+**      You may obtain a copy of the License at
+**
+**        http://www.apache.org/licenses/LICENSE-2.0
+**
+**      Unless required by applicable law or agreed to in writing, software
+**      distributed under the License is distributed on an "AS IS" BASIS,
+**      WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**      See the License for the specific language governing permissions and
+**      limitations under the License.
+**
+** File: object_tracking_app_keypoints.c
+**
+** Purpose:
+**   Stores the 3D keypoints of every detection and derives centroid,
+**   bounding extent, heading and per-keypoint displacement once onboard.
+**
+** Notes:
+**   The kernels are branch-free loops over fixed-length float arrays with
+**   missing keypoints masked out arithmetically, so the compiler can
+**   unroll and vectorize them for the target (SSE/AVX/NEON) without
+**   intrinsics.
+**
+*******************************************************************************/
+
+/*
+** Include Files:
+*/
+#include <math.h>
+
+#include "object_tracking_app_keypoints.h"
+
+#define OBJECT_RAD_TO_DEG     57.29577951308232f
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  OBJECT_Kp_Centroid                                                 */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Mean of the present keypoints, returns how many were present       */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * *  * *  * * * * */
+static float OBJECT_Kp_Centroid(const float *restrict x, const float *restrict y,
+                                const float *restrict z, const float *restrict valid,
+                                float centroid[3]){
+    float sumX = 0.0f;
+    float sumY = 0.0f;
+    float sumZ = 0.0f;
+    float count = 0.0f;
+    int   itr;
+
+    for(itr = 0; itr < OBJECT_KEYPOINT_COUNT; itr++){
+        sumX += x[itr] * valid[itr];
+        sumY += y[itr] * valid[itr];
+        sumZ += z[itr] * valid[itr];
+        count += valid[itr];
+    }
+
+    if(count > 0.0f){
+        centroid[0] = sumX / count;
+        centroid[1] = sumY / count;
+        centroid[2] = sumZ / count;
+    } else {
+        centroid[0] = 0.0f;
+        centroid[1] = 0.0f;
+        centroid[2] = 0.0f;
+    }
+
+    return(count);
+
+} /* End of OBJECT_Kp_Centroid */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  OBJECT_Kp_Extent                                                   */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Axis aligned bounding box of the present keypoints                 */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * *  * *  * * * * */
+static void OBJECT_Kp_Extent(const float *restrict x, const float *restrict y,
+                             const float *restrict z, const float *restrict valid,
+                             float extentMin[3], float extentMax[3]){
+    float minX = INFINITY, minY = INFINITY, minZ = INFINITY;
+    float maxX = -INFINITY, maxY = -INFINITY, maxZ = -INFINITY;
+    int   itr;
+
+    // Missing keypoints are replaced by values that never win the comparison
+    for(itr = 0; itr < OBJECT_KEYPOINT_COUNT; itr++){
+        float present = valid[itr] > 0.0f;
+
+        minX = fminf(minX, present ? x[itr] : INFINITY);
+        minY = fminf(minY, present ? y[itr] : INFINITY);
+        minZ = fminf(minZ, present ? z[itr] : INFINITY);
+        maxX = fmaxf(maxX, present ? x[itr] : -INFINITY);
+        maxY = fmaxf(maxY, present ? y[itr] : -INFINITY);
+        maxZ = fmaxf(maxZ, present ? z[itr] : -INFINITY);
+    }
+
+    // No keypoints - collapse the box to the origin
+    if(minX > maxX){
+        minX = minY = minZ = maxX = maxY = maxZ = 0.0f;
+    }
+
+    extentMin[0] = minX;
+    extentMin[1] = minY;
+    extentMin[2] = minZ;
+    extentMax[0] = maxX;
+    extentMax[1] = maxY;
+    extentMax[2] = maxZ;
+
+} /* End of OBJECT_Kp_Extent */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  OBJECT_Kp_Displacement                                             */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Distance every keypoint travelled between two samples, 0 where     */
+/*         the keypoint is missing in either sample                           */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * *  * *  * * * * */
+static void OBJECT_Kp_Displacement(const float *restrict x0, const float *restrict y0,
+                                   const float *restrict z0, const float *restrict valid0,
+                                   const float *restrict x1, const float *restrict y1,
+                                   const float *restrict z1, const float *restrict valid1,
+                                   float *restrict displacement){
+    int itr;
+
+    for(itr = 0; itr < OBJECT_KEYPOINT_COUNT; itr++){
+        float dx = x1[itr] - x0[itr];
+        float dy = y1[itr] - y0[itr];
+        float dz = z1[itr] - z0[itr];
+
+        displacement[itr] = sqrtf((dx * dx) + (dy * dy) + (dz * dz)) * valid0[itr] * valid1[itr];
+    }
+
+} /* End of OBJECT_Kp_Displacement */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  OBJECT_Keypoints_Store                                             */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Copies the detection's keypoints into the next slot of its track's */
+/*         buffer and computes their geometry against the track's previous    */
+/*         sample. Detections without a track id are not stored.              */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * *  * *  * * * * */
+void OBJECT_Keypoints_Store(OBJECT_Keypoints_t *keypoints, uint16 track_id, const rover_state *state){
+    OBJECT_Keypoint_Buffer_t *buffer;
+    uint32 slot;
+    uint32 prev;
+    const OBJECT_Pose_Sample_t *prevSample;
+    const OBJECT_Pose_Data_t *prevPose;
+    OBJECT_Pose_Sample_t sample;
+    OBJECT_Pose_Data_t *pose = &sample.pose;
+    float dx;
+    float dy;
+    int   itr;
+
+    if((track_id == 0) || (track_id > OBJECT_DICT_MAX_TRACKS)){
+        return;
+    }
+
+    buffer = &keypoints->tracks[track_id - 1];
+    slot = buffer->poses.head & OBJECT_KEYPOINT_SLOT_MASK;
+    prev = (buffer->poses.head - 1) & OBJECT_KEYPOINT_SLOT_MASK;
+    prevSample = OBJECT_Pose_History_Newest(&buffer->poses);
+
+    // Array-of-structs to struct-of-arrays
+    for(itr = 0; itr < OBJECT_KEYPOINT_COUNT; itr++){
+        buffer->x[slot][itr] = (float) state->keypoint_3D_listing[itr].x;
+        buffer->y[slot][itr] = (float) state->keypoint_3D_listing[itr].y;
+        buffer->z[slot][itr] = (float) state->keypoint_3D_listing[itr].z;
+
+        // YOLO reports keypoints it didn't find as all zeros
+        buffer->valid[slot][itr] = ((buffer->x[slot][itr] != 0.0f) ||
+                                    (buffer->y[slot][itr] != 0.0f) ||
+                                    (buffer->z[slot][itr] != 0.0f)) ? 1.0f : 0.0f;
+    }
+
+    sample.key = OBJECT_HISTORY_TIME_KEY(state->timeStamp_sec, state->timeStamp_nanoSec);
+
+    memset(pose, 0, sizeof(*pose));
+
+    pose->keypoint_count = (uint8) OBJECT_Kp_Centroid(buffer->x[slot], buffer->y[slot], buffer->z[slot],
+                                                      buffer->valid[slot], pose->centroid);
+
+    OBJECT_Kp_Extent(buffer->x[slot], buffer->y[slot], buffer->z[slot], buffer->valid[slot],
+                     pose->extent_min, pose->extent_max);
+
+    // Motion needs a previous sample
+    if(prevSample != NULL){
+        prevPose = &prevSample->pose;
+
+        OBJECT_Kp_Displacement(buffer->x[prev], buffer->y[prev], buffer->z[prev], buffer->valid[prev],
+                               buffer->x[slot], buffer->y[slot], buffer->z[slot], buffer->valid[slot],
+                               pose->displacement);
+
+        // Heading holds its last value while the object isn't moving
+        dx = pose->centroid[0] - prevPose->centroid[0];
+        dy = pose->centroid[1] - prevPose->centroid[1];
+        if((pose->keypoint_count > 0) && (prevPose->keypoint_count > 0) && ((dx != 0.0f) || (dy != 0.0f))){
+            pose->heading = atan2f(dy, dx) * OBJECT_RAD_TO_DEG;
+        } else {
+            pose->heading = prevPose->heading;
+        }
+    }
+
+    // Lands in 'slot', next to the coordinates
+    OBJECT_Pose_History_Append(&buffer->poses, &sample);
+
+} /* End of OBJECT_Keypoints_Store */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  OBJECT_Keypoints_Find                                              */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Looks up the geometry of a track's sample with the given           */
+/*         timestamp, newest first. Returns NULL once it has left the side    */
+/*         buffer.                                                            */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * *  * *  * * * * */
+const OBJECT_Pose_Data_t *OBJECT_Keypoints_Find(const OBJECT_Keypoints_t *keypoints, uint16 track_id,
+                                                uint32 timeStamp_sec, uint32 timeStamp_nanoSec){
+    const OBJECT_Pose_Sample_t *sample;
+
+    if((track_id == 0) || (track_id > OBJECT_DICT_MAX_TRACKS)){
+        return(NULL);
+    }
+
+    // Stored in arrival order, not necessarily timestamp order
+    sample = OBJECT_Pose_History_Find_Newest(&keypoints->tracks[track_id - 1].poses,
+                                             OBJECT_HISTORY_TIME_KEY(timeStamp_sec, timeStamp_nanoSec));
+
+    return((sample != NULL) ? &sample->pose : NULL);
+
+} /* End of OBJECT_Keypoints_Find */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  OBJECT_Keypoints_Clear_Track                                       */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Forgets a deleted track, its id may be reused                      */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * *  * *  * * * * */
+void OBJECT_Keypoints_Clear_Track(OBJECT_Keypoints_t *keypoints, uint16 track_id){
+
+    if((track_id != 0) && (track_id <= OBJECT_DICT_MAX_TRACKS)){
+        memset(&keypoints->tracks[track_id - 1], 0, sizeof(OBJECT_Keypoint_Buffer_t));
+    }
+
+} /* End of OBJECT_Keypoints_Clear_Track */
@@ -0,0 +1,83 @@
+/*******************************************************************************
+**
+**      GSC-18128-1, "Core Flight Executive Version 6.7"
+**
+**      Copyright (c) 2006-2019 United States Government as represented by
+**      the Administrator of the National Aeronautics and Space Administration.
+**      All Rights Reserved.
+**
+**      Licensed under the Apache License, Version 2.0 (the "License");
+**      you may not use this file except in compliance with the License.
+**      You may obtain a copy of the License at
+**
+**        http://www.apache.org/licenses/LICENSE-2.0
+**
+**      Unless required by applicable law or agreed to in writing, software
+**      distributed under the License is distributed on an "AS IS" BASIS,
+**      WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**      See the License for the specific language governing permissions and
+**      limitations under the License.
+**
+** File: object_tracking_app_keypoints.h
+**
+** Purpose:
+**   Per-track structure-of-arrays keypoint storage and the geometry kernels
+**   that run over it.
+**
+*******************************************************************************/
+
+#ifndef _object_tracking_app_keypoints_h_
+#define _object_tracking_app_keypoints_h_
+
+#include "cfe.h"
+
+#include "object_tracking_app_msg.h"
+#include "object_tracking_app_history.h"
+#include "object_tracking_app_compact.h"
+#include "sync_node_lib.h"
+
+// Keypoint samples kept per track, a power of two
+#define OBJECT_KEYPOINT_SLOTS                 32
+#define OBJECT_KEYPOINT_SLOT_MASK             (OBJECT_KEYPOINT_SLOTS - 1)
+
+// Derived geometry of one keypoint sample, keyed by its timestamp
+typedef struct
+{
+    uint64              key;
+    OBJECT_Pose_Data_t  pose;
+} OBJECT_Pose_Sample_t;
+
+static inline uint64 OBJECT_Pose_Sample_Key(const OBJECT_Pose_Sample_t *sample){
+    return(sample->key);
+}
+
+OBJECT_HISTORY_DEFINE(OBJECT_Pose_History, OBJECT_Pose_Sample_t, OBJECT_KEYPOINT_SLOTS, OBJECT_Pose_Sample_Key)
+
+// Keypoint side buffer of one track - each slot holds one sample
+// Coordinates are split per axis so the kernels run over contiguous floats
+typedef struct
+{
+    float               x[OBJECT_KEYPOINT_SLOTS][OBJECT_KEYPOINT_COUNT];
+    float               y[OBJECT_KEYPOINT_SLOTS][OBJECT_KEYPOINT_COUNT];
+    float               z[OBJECT_KEYPOINT_SLOTS][OBJECT_KEYPOINT_COUNT];
+
+    // 1.0 for keypoints that were present, 0.0 otherwise
+    float               valid[OBJECT_KEYPOINT_SLOTS][OBJECT_KEYPOINT_COUNT];
+
+    // Timestamp and derived geometry, appended in step with the
+    // coordinates so both use slot ('poses.head' % OBJECT_KEYPOINT_SLOTS)
+    OBJECT_Pose_History_t poses;
+} OBJECT_Keypoint_Buffer_t;
+
+typedef struct
+{
+    // Indexed by track id - 1, so motion is always measured against the same object
+    OBJECT_Keypoint_Buffer_t    tracks[OBJECT_DICT_MAX_TRACKS];
+} OBJECT_Keypoints_t;
+
+void                      OBJECT_Keypoints_Store(OBJECT_Keypoints_t *keypoints, uint16 track_id, const rover_state *state);
+const OBJECT_Pose_Data_t *OBJECT_Keypoints_Find(const OBJECT_Keypoints_t *keypoints, uint16 track_id,
+                                                uint32 timeStamp_sec, uint32 timeStamp_nanoSec);
+void                      OBJECT_Keypoints_Clear_Track(OBJECT_Keypoints_t *keypoints, uint16 track_id);
+
+#endif /* _object_tracking_app_keypoints_h_ */
@@ -0,0 +1,226 @@
+/*******************************************************************************
+**
+**      GSC-18128-1, "Core Flight Executive Version 6.7"
+**
+**      Copyright (c) 2006-2019 United States Government as represented by
+**      the Administrator of the National Aeronautics and Space Administration.
+**      All Rights Reserved.
+**
+**      Licensed under the Apache License, Version 2.0 (the "License");
+**      you may not use this file except in compliance with the License.
+**      You may obtain a copy of the License at
+**
+**        http://www.apache.org/licenses/LICENSE-2.0
+**
+**      Unless required by applicable law or agreed to in writing, software
+**      distributed under the License is distributed on an "AS IS" BASIS,
+**      WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**      See the License for the specific language governing permissions and
+**      limitations under the License.
+**
+** File: object_tracking_app_kinematics.c
+**
+** Purpose:
+**   Derives range rate, bearing rate, planar velocity and time to contact
+**   for every detection of a frame in one batched pass, so consumers don't
+**   each have to difference the histories themselves.
+**
+** Notes:
+**   A frame is gathered into flat arrays (current and previous observation
+**   per detection), run through a single branch-free kernel and scattered
+**   back into the per-track table.
+**
+*******************************************************************************/
+
+/*
+** Include Files:
+*/
+#include <math.h>
+
+#include "object_tracking_app_kinematics.h"
+
+#define OBJECT_DEG_TO_RAD     0.017453292519943295
+
+/*
+** Kernel input/output for one batch, one entry per detection
+*/
+typedef struct
+{
+    double  distance[OBJECT_KIN_BATCH];
+    double  bearing[OBJECT_KIN_BATCH];
+    double  prevDistance[OBJECT_KIN_BATCH];
+    double  prevBearing[OBJECT_KIN_BATCH];
+
+    // Seconds since the previous observation, 0 when there is none
+    double  dt[OBJECT_KIN_BATCH];
+
+    double  rangeRate[OBJECT_KIN_BATCH];
+    double  bearingRate[OBJECT_KIN_BATCH];
+    double  velocityX[OBJECT_KIN_BATCH];
+    double  velocityY[OBJECT_KIN_BATCH];
+    double  timeToContact[OBJECT_KIN_BATCH];
+} OBJECT_Kinematics_Batch_t;
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  OBJECT_Kinematics_Kernel                                           */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Computes the kinematics of 'count' detections at once              */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * *  * *  * * * * */
+static void OBJECT_Kinematics_Kernel(OBJECT_Kinematics_Batch_t *restrict batch, int count){
+    int itr;
+
+    for(itr = 0; itr < count; itr++){
+        double dt = batch->dt[itr];
+
+        // Division guarded without branching, rates come out 0 without history
+        double invDt = (dt > 0.0) ? (1.0 / dt) : 0.0;
+
+        // Bearing change taken the short way around
+        double turn = batch->bearing[itr] - batch->prevBearing[itr];
+        turn -= 360.0 * floor((turn + 180.0) / 360.0);
+
+        double rangeRate = (batch->distance[itr] - batch->prevDistance[itr]) * invDt;
+
+        // Planar position in the sensor frame, x along bearing 0
+        double x  = batch->distance[itr] * cos(batch->bearing[itr] * OBJECT_DEG_TO_RAD);
+        double y  = batch->distance[itr] * sin(batch->bearing[itr] * OBJECT_DEG_TO_RAD);
+        double x0 = batch->prevDistance[itr] * cos(batch->prevBearing[itr] * OBJECT_DEG_TO_RAD);
+        double y0 = batch->prevDistance[itr] * sin(batch->prevBearing[itr] * OBJECT_DEG_TO_RAD);
+
+        batch->rangeRate[itr] = rangeRate;
+        batch->bearingRate[itr] = turn * invDt;
+        batch->velocityX[itr] = (x - x0) * invDt;
+        batch->velocityY[itr] = (y - y0) * invDt;
+
+        // Only closing objects have a contact time
+        batch->timeToContact[itr] = (rangeRate < 0.0) ? (batch->distance[itr] / -rangeRate) : -1.0;
+    }
+
+} /* End of OBJECT_Kinematics_Kernel */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  OBJECT_Kinematics_Update                                           */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Gathers a frame's detections, runs the kernel and stores the       */
+/*         results and the new observations per track. Shards call it with    */
+/*         their own classes' detections, so the batch lives on the stack     */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * *  * *  * * * * */
+void OBJECT_Kinematics_Update(OBJECT_Kinematics_Table_t *table, OBJECT_Compact_Data_t *compact,
+                              const rover_state *const *detections, int detection_count){
+    OBJECT_Kinematics_Batch_t batch;
+    OBJECT_Kinematics_Track_t *tracks[OBJECT_KIN_BATCH];
+    const rover_state *states[OBJECT_KIN_BATCH];
+    OBJECT_Kinematics_Track_t *track;
+    const rover_state *state;
+    uint16 track_id;
+    double dt;
+    double innovation;
+    int    first;
+    int    last;
+    int    count;
+    int    itr;
+
+    for(first = 0; first < detection_count; first += OBJECT_KIN_BATCH){
+        last = ((first + OBJECT_KIN_BATCH) < detection_count) ? (first + OBJECT_KIN_BATCH) : detection_count;
+
+        //// Gather
+        count = 0;
+        for(itr = first; itr < last; itr++){
+            state = detections[itr];
+
+            // Detections without a track id have nothing to difference against
+            track_id = OBJECT_Dict_Track_Id(compact, state);
+            if(track_id == 0){
+                continue;
+            }
+
+            track = &table->tracks[track_id - 1];
+
+            dt = ((double) state->timeStamp_sec - (double) track->timeStamp_sec) +
+                 (((double) state->timeStamp_nanoSec - (double) track->timeStamp_nanoSec) / 1000000000.0);
+
+            if(!track->seen || (dt <= 0.0) || (dt > OBJECT_KIN_MAX_GAP_SEC)){
+                dt = 0.0;
+            }
+
+            tracks[count] = track;
+            states[count] = state;
+            batch.distance[count] = state->distance;
+            batch.bearing[count] = state->orientation;
+            batch.prevDistance[count] = (dt > 0.0) ? track->distance : state->distance;
+            batch.prevBearing[count] = (dt > 0.0) ? track->orientation : state->orientation;
+            batch.dt[count] = dt;
+            count++;
+        }
+
+        //// Compute
+        OBJECT_Kinematics_Kernel(&batch, count);
+
+        //// Scatter
+        for(itr = 0; itr < count; itr++){
+            track = tracks[itr];
+            state = states[itr];
+
+            // Rate variances follow the change between consecutive estimates
+            if(batch.dt[itr] > 0.0){
+                if(track->result.valid){
+                    innovation = batch.rangeRate[itr] - track->result.range_rate;
+                    track->range_rate_var += OBJECT_KIN_RATE_ALPHA * ((innovation * innovation) - track->range_rate_var);
+
+                    innovation = batch.bearingRate[itr] - track->result.bearing_rate;
+                    track->bearing_rate_var += OBJECT_KIN_RATE_ALPHA * ((innovation * innovation) - track->bearing_rate_var);
+                } else {
+                    track->range_rate_var = OBJECT_KIN_RANGE_RATE_VAR_INIT;
+                    track->bearing_rate_var = OBJECT_KIN_BEARING_RATE_VAR_INIT;
+                }
+            }
+
+            track->result.valid = (batch.dt[itr] > 0.0);
+            track->result.range_rate = (float) batch.rangeRate[itr];
+            track->result.bearing_rate = (float) batch.bearingRate[itr];
+            track->result.velocity[0] = (float) batch.velocityX[itr];
+            track->result.velocity[1] = (float) batch.velocityY[itr];
+            track->result.time_to_contact = (float) batch.timeToContact[itr];
+
+            track->seen = true;
+            track->timeStamp_sec = state->timeStamp_sec;
+            track->timeStamp_nanoSec = state->timeStamp_nanoSec;
+            track->distance = state->distance;
+            track->orientation = state->orientation;
+        }
+    }
+
+} /* End of OBJECT_Kinematics_Update */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  OBJECT_Kinematics_Find                                             */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Returns the kinematics computed for a sample, NULL if the sample   */
+/*         isn't its track's latest observation any more                      */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * *  * *  * * * * */
+const OBJECT_Kinematics_Data_t *OBJECT_Kinematics_Find(const OBJECT_Kinematics_Table_t *table,
+                                                       const OBJECT_Compact_Data_t *compact,
+                                                       const rover_state *state){
+    const OBJECT_Kinematics_Track_t *track;
+    uint16 track_id = OBJECT_Dict_Lookup(compact, state);
+
+    if(track_id == 0){
+        return(NULL);
+    }
+
+    track = &table->tracks[track_id - 1];
+    if(!track->seen ||
+       (track->timeStamp_sec != state->timeStamp_sec) ||
+       (track->timeStamp_nanoSec != state->timeStamp_nanoSec)){
+        return(NULL);
+    }
+
+    return(&track->result);
+
+} /* End of OBJECT_Kinematics_Find */
@@ -0,0 +1,78 @@
+/*******************************************************************************
+**
+**      GSC-18128-1, "Core Flight Executive Version 6.7"
+**
+**      Copyright (c) 2006-2019 United States Government as represented by
+**      the Administrator of the National Aeronautics and Space Administration.
+**      All Rights Reserved.
+**
+**      Licensed under the Apache License, Version 2.0 (the "License");
+**      you may not use this file except in compliance with the License.
+**      You may obtain a copy of the License at
+**
+**        http://www.apache.org/licenses/LICENSE-2.0
+**
+**      Unless required by applicable law or agreed to in writing, software
+**      distributed under the License is distributed on an "AS IS" BASIS,
+**      WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**      See the License for the specific language governing permissions and
+**      limitations under the License.
+**
+** File: object_tracking_app_kinematics.h
+**
+** Purpose:
+**   Per-track derived kinematics (range rate, bearing rate, planar velocity
+**   and time to contact), computed once per ingested frame.
+**
+*******************************************************************************/
+
+#ifndef _object_tracking_app_kinematics_h_
+#define _object_tracking_app_kinematics_h_
+
+#include "cfe.h"
+
+#include "object_tracking_app_msg.h"
+#include "object_tracking_app_compact.h"
+#include "sync_node_lib.h"
+
+// Largest frame handled by one kernel pass, bigger frames run in several passes
+#define OBJECT_KIN_BATCH                      32
+
+// Observations further apart than this restart the track's motion estimate
+#define OBJECT_KIN_MAX_GAP_SEC                2.0
+
+// Smoothing of the rate variances and their value for a new estimate,
+// (m/s)^2 and (deg/s)^2
+#define OBJECT_KIN_RATE_ALPHA                 0.2
+#define OBJECT_KIN_RANGE_RATE_VAR_INIT        0.25
+#define OBJECT_KIN_BEARING_RATE_VAR_INIT      25.0
+
+// Last observation and derived kinematics of one track
+typedef struct
+{
+    bool                        seen;
+    uint32                      timeStamp_sec;
+    uint32                      timeStamp_nanoSec;
+    double                      distance;
+    double                      orientation;
+    OBJECT_Kinematics_Data_t    result;
+
+    // Spread of the rate from one observation to the next, used as the
+    // uncertainty of predictions
+    double                      range_rate_var;
+    double                      bearing_rate_var;
+} OBJECT_Kinematics_Track_t;
+
+typedef struct
+{
+    // Indexed by track id - 1, same ids as the compact dictionary
+    OBJECT_Kinematics_Track_t   tracks[OBJECT_DICT_MAX_TRACKS];
+} OBJECT_Kinematics_Table_t;
+
+void OBJECT_Kinematics_Update(OBJECT_Kinematics_Table_t *table, OBJECT_Compact_Data_t *compact,
+                              const rover_state *const *detections, int detection_count);
+const OBJECT_Kinematics_Data_t *OBJECT_Kinematics_Find(const OBJECT_Kinematics_Table_t *table,
+                                                       const OBJECT_Compact_Data_t *compact,
+                                                       const rover_state *state);
+
+#endif /* _object_tracking_app_kinematics_h_ */
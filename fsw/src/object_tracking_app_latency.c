@@ -0,0 +1,215 @@
+/*******************************************************************************
+**
+**      GSC-18128-1, "Core Flight Executive Version 6.7"
+**
+**      Copyright (c) 2006-2019 United States Government as represented by
+**      the Administrator of the National Aeronautics and Space Administration.
+**      All Rights Reserved.
+**
+**      Licensed under the Apache License, Version 2.0 (the "License");
+**      you may not use this file except in compliance with the License.
+**      You may obtain a copy of the License at
+**
+**        http://www.apache.org/licenses/LICENSE-2.0
+**
+**      Unless required by applicable law or agreed to in writing, software
+**      distributed under the License is distributed on an "AS IS" BASIS,
+**      WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**      See the License for the specific language governing permissions and
+**      limitations under the License.
+**
+**
+** File: object_tracking_app_latency.c
+**
+** Purpose:
+**   Times every published sample through the ingest stages and reports
+**   rolling percentiles, raising an event when the p99 age breaks the SLA.
+**
+*******************************************************************************/
+
+/*
+** Include Files:
+*/
+#include <stdlib.h>
+
+#include "object_tracking_app_msgids.h"
+#include "object_tracking_app_events.h"
+#include "object_tracking_app_predict.h"
+#include "object_tracking_app_latency.h"
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  OBJECT_Latency_Init                                                */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Clears the windows and initializes the percentile packet           */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * *  * *  * * * * */
+void OBJECT_Latency_Init(OBJECT_Latency_t *latency){
+
+    memset(latency, 0, sizeof(*latency));
+    latency->sla_p99_us = OBJECT_LATENCY_SLA_P99_US_DEFAULT;
+
+    CFE_SB_InitMsg(&latency->msg,
+                   OBJECT_TRACKER_LATENCY_PUB,
+                   sizeof(latency->msg),
+                   true);
+
+} /* End of OBJECT_Latency_Init */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  OBJECT_Latency_Now                                                 */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Current cFE time in microseconds                                   */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * *  * *  * * * * */
+uint64 OBJECT_Latency_Now(void){
+    CFE_TIME_SysTime_t now = CFE_TIME_GetTime();
+
+    return(((uint64) now.Seconds * 1000000) + CFE_TIME_Sub2MicroSecs(now.Subseconds));
+
+} /* End of OBJECT_Latency_Now */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  OBJECT_Latency_Age                                                 */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Microseconds from a detection timestamp to 'now', 0 when the       */
+/*         detector clock is ahead                                            */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * *  * *  * * * * */
+uint32 OBJECT_Latency_Age(uint32 timeStamp_sec, uint32 timeStamp_nanoSec, uint64 now){
+    uint64 detected;
+
+    detected = (((uint64) timeStamp_sec + OBJECT_LATENCY_EPOCH_OFFSET_SEC) * 1000000) + (timeStamp_nanoSec / 1000);
+    if(detected >= now){
+        return(0);
+    }
+
+    return(((now - detected) > 0xFFFFFFFF) ? 0xFFFFFFFF : (uint32) (now - detected));
+
+} /* End of OBJECT_Latency_Age */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  OBJECT_Latency_Add                                                 */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Adds one duration to a stage window                                */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * *  * *  * * * * */
+static void OBJECT_Latency_Add(OBJECT_Latency_Window_t *window, uint64 begin, uint64 end){
+    uint64 duration = (end > begin) ? (end - begin) : 0;
+
+    window->samples[window->next] = (duration > 0xFFFFFFFF) ? 0xFFFFFFFF : (uint32) duration;
+    window->next = (window->next + 1) % OBJECT_LATENCY_WINDOW;
+
+    if(window->count < OBJECT_LATENCY_WINDOW){
+        window->count++;
+    }
+
+} /* End of OBJECT_Latency_Add */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  OBJECT_Latency_Record                                              */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Times a sample published at 'now' through every stage.             */
+/*         Returns its detection-to-publish age.                              */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * *  * *  * * * * */
+uint32 OBJECT_Latency_Record(OBJECT_Latency_t *latency, const OBJECT_Latency_Trace_t *trace,
+                             const rover_state *state, uint64 now){
+    uint32 age = OBJECT_Latency_Age(state->timeStamp_sec, state->timeStamp_nanoSec, now);
+
+    OBJECT_Latency_Add(&latency->stages[OBJECT_LATENCY_STAGE_PARSE], trace->arrival_us, trace->parsed_us);
+    OBJECT_Latency_Add(&latency->stages[OBJECT_LATENCY_STAGE_INSERT], trace->parsed_us, trace->inserted_us);
+    OBJECT_Latency_Add(&latency->stages[OBJECT_LATENCY_STAGE_QUEUE], trace->inserted_us, now);
+    OBJECT_Latency_Add(&latency->stages[OBJECT_LATENCY_STAGE_AGE], 0, age);
+
+    return(age);
+
+} /* End of OBJECT_Latency_Record */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  OBJECT_Latency_Compare                                             */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         qsort order for durations                                          */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * *  * *  * * * * */
+static int OBJECT_Latency_Compare(const void *a, const void *b){
+    uint32 left = *(const uint32 *) a;
+    uint32 right = *(const uint32 *) b;
+
+    return((left > right) - (left < right));
+
+} /* End of OBJECT_Latency_Compare */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  OBJECT_Latency_Report                                              */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Called every cycle. Sends the percentile packet every              */
+/*         OBJECT_LATENCY_REPORT_CYCLES cycles and checks the p99 age         */
+/*         against the SLA, with one event per violation and recovery         */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * *  * *  * * * * */
+void OBJECT_Latency_Report(OBJECT_Latency_t *latency){
+    static uint32 sorted[OBJECT_LATENCY_WINDOW];
+    OBJECT_Latency_Payload_t *payload = &latency->msg.Payload;
+    OBJECT_Latency_Window_t *window;
+    uint32 count;
+    bool   violated;
+    int    stage;
+
+    if(++latency->cycle < OBJECT_LATENCY_REPORT_CYCLES){
+        return;
+    }
+    latency->cycle = 0;
+
+    // Nothing published since startup
+    if(latency->stages[OBJECT_LATENCY_STAGE_AGE].count == 0){
+        return;
+    }
+
+    for(stage = 0; stage < OBJECT_LATENCY_STAGES; stage++){
+        window = &latency->stages[stage];
+        count = window->count;
+
+        memcpy(sorted, window->samples, count * sizeof(sorted[0]));
+        qsort(sorted, count, sizeof(sorted[0]), OBJECT_Latency_Compare);
+
+        payload->stages[stage].p50_us = sorted[(count * 50) / 100];
+        payload->stages[stage].p95_us = sorted[(count * 95) / 100];
+        payload->stages[stage].p99_us = sorted[(count * 99) / 100];
+        payload->stages[stage].max_us = sorted[count - 1];
+    }
+
+    violated = (latency->sla_p99_us != 0) &&
+               (payload->stages[OBJECT_LATENCY_STAGE_AGE].p99_us > latency->sla_p99_us);
+
+    if(violated && !latency->sla_violated){
+        latency->sla_violation_count++;
+
+        CFE_EVS_SendEvent(OBJECT_LATENCY_SLA_ERR_EID,
+                          CFE_EVS_EventType_ERROR,
+                          "Latency SLA violated: p99 age %lu us > %lu us",
+                          (unsigned long) payload->stages[OBJECT_LATENCY_STAGE_AGE].p99_us,
+                          (unsigned long) latency->sla_p99_us);
+    } else if(!violated && latency->sla_violated){
+        CFE_EVS_SendEvent(OBJECT_LATENCY_SLA_INF_EID,
+                          CFE_EVS_EventType_INFORMATION,
+                          "Latency SLA recovered: p99 age %lu us",
+                          (unsigned long) payload->stages[OBJECT_LATENCY_STAGE_AGE].p99_us);
+    }
+    latency->sla_violated = violated;
+
+    payload->sample_count = latency->stages[OBJECT_LATENCY_STAGE_AGE].count;
+    payload->sla_p99_us = latency->sla_p99_us;
+    payload->sla_violation_count = latency->sla_violation_count;
+    payload->sla_violated = violated;
+
+    CFE_SB_TimeStampMsg((CFE_SB_MsgPtr_t) &latency->msg);
+    CFE_SB_SendMsg((CFE_SB_MsgPtr_t) &latency->msg);
+
+} /* End of OBJECT_Latency_Report */
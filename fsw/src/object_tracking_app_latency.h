@@ -0,0 +1,75 @@
+/*******************************************************************************
+**
+**      GSC-18128-1, "Core Flight Executive Version 6.7"
+**
+**      Copyright (c) 2006-2019 United States Government as represented by
+**      the Administrator of the National Aeronautics and Space Administration.
+**      All Rights Reserved.
+**
+**      Licensed under the Apache License, Version 2.0 (the "License");
+**      you may not use this file except in compliance with the License.
+**      You may obtain a copy of the License at
+**
+**        http://www.apache.org/licenses/LICENSE-2.0
+**
+**      Unless required by applicable law or agreed to in writing, software
+**      distributed under the License is distributed on an "AS IS" BASIS,
+**      WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**      See the License for the specific language governing permissions and
+**      limitations under the License.
+**
+**
+** File: object_tracking_app_latency.h
+**
+** Purpose:
+**   Pipeline latency tracing from detection to software bus publication.
+**
+*******************************************************************************/
+
+#ifndef _object_tracking_app_latency_h_
+#define _object_tracking_app_latency_h_
+
+#include "cfe.h"
+
+#include "object_tracking_app_msg.h"
+
+// Published samples the percentiles are taken over
+#define OBJECT_LATENCY_WINDOW                 512
+
+// Main loop cycles between two latency packets
+#define OBJECT_LATENCY_REPORT_CYCLES          20
+
+// Detection-to-publish p99 above which an event is raised at startup, 0 disables
+#define OBJECT_LATENCY_SLA_P99_US_DEFAULT     250000
+
+// Seconds to add to a detection timestamp to get cFE seconds
+#define OBJECT_LATENCY_EPOCH_OFFSET_SEC       OBJECT_PREDICT_EPOCH_OFFSET_SEC
+
+// Last OBJECT_LATENCY_WINDOW durations of one stage
+typedef struct
+{
+    uint32      samples[OBJECT_LATENCY_WINDOW];
+    uint32      count;
+    uint32      next;
+} OBJECT_Latency_Window_t;
+
+typedef struct
+{
+    OBJECT_Latency_Window_t stages[OBJECT_LATENCY_STAGES];
+
+    uint32                  sla_p99_us;
+    bool                    sla_violated;
+    uint32                  sla_violation_count;
+    uint32                  cycle;
+
+    OBJECT_Latency_Packet_t msg;
+} OBJECT_Latency_t;
+
+void   OBJECT_Latency_Init(OBJECT_Latency_t *latency);
+uint64 OBJECT_Latency_Now(void);
+uint32 OBJECT_Latency_Age(uint32 timeStamp_sec, uint32 timeStamp_nanoSec, uint64 now);
+uint32 OBJECT_Latency_Record(OBJECT_Latency_t *latency, const OBJECT_Latency_Trace_t *trace,
+                             const rover_state *state, uint64 now);
+void   OBJECT_Latency_Report(OBJECT_Latency_t *latency);
+
+#endif /* _object_tracking_app_latency_h_ */
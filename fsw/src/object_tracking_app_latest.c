@@ -0,0 +1,159 @@
+/*******************************************************************************
+**
+**      GSC-18128-1, "Core Flight Executive Version 6.7"
+**
+**      Copyright (c) 2006-2019 United States Government as represented by
+**      the Administrator of the National Aeronautics and Space Administration.
+**      All Rights Reserved.
+**
+**      Licensed under the Apache License, Version 2.0 (the "License");
+**      you may not use this file except in compliance with the License.
+**      You may obtain a copy of the License at
+**
+**        http://www.apache.org/licenses/LICENSE-2.0
+**
+**      Unless required by applicable law or agreed to in writing, software
+**      distributed under the License is distributed on an "AS IS" BASIS,
+**      WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**      See the License for the specific language governing permissions and
+**      limitations under the License.
+**
+**
+** File: object_tracking_app_latest.c
+**
+** Purpose:
+**   Keeps the newest detection of every track and writes it once per cycle
+**   into the latest-state table that local apps read without messages.
+**
+** Notes:
+**   Ingest updates the private staging entries, readers never see them.
+**   'OBJECT_Latest_Publish' copies the staged tracks into the buffer the
+**   readers are not using and then flips 'latest', see the protocol in
+**   object_tracking_latest.h.
+**
+*******************************************************************************/
+
+/*
+** Include Files:
+*/
+#include "object_tracking_app_latest.h"
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  OBJECT_Latest_Init                                                 */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Empty table, registered as a dump-only table at our own address    */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * *  * *  * * * * */
+int32 OBJECT_Latest_Init(OBJECT_Latest_t *latest){
+    int32 status;
+
+    memset(latest, 0, sizeof(*latest));
+
+    status = CFE_TBL_Register(&latest->handle, OBJECT_LATEST_TABLE_NAME, sizeof(latest->table),
+                              CFE_TBL_OPT_USR_DEF_ADDR, NULL);
+    if(status != CFE_SUCCESS){
+        return(status);
+    }
+
+    return(CFE_TBL_Load(latest->handle, CFE_TBL_SRC_ADDRESS, &latest->table));
+
+} /* End of OBJECT_Latest_Init */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  OBJECT_Latest_Update                                               */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Stages a detection unless its track has a newer one                */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * *  * *  * * * * */
+void OBJECT_Latest_Update(OBJECT_Latest_t *latest, uint16 track_id, const rover_state *state){
+    OBJECT_Latest_Entry_t *entry;
+
+    if((track_id == 0) || (track_id > OBJECT_DICT_MAX_TRACKS)){
+        return;
+    }
+
+    entry = &latest->staging[track_id - 1];
+
+    // Delayed detections don't replace newer ones
+    if((entry->track_id != 0) &&
+       ((state->timeStamp_sec < entry->timeStamp_sec) ||
+        ((state->timeStamp_sec == entry->timeStamp_sec) && (state->timeStamp_nanoSec < entry->timeStamp_nanoSec)))){
+        return;
+    }
+
+    entry->timeStamp_sec = state->timeStamp_sec;
+    entry->timeStamp_nanoSec = state->timeStamp_nanoSec;
+    entry->track_id = track_id;
+    entry->class_id = state->class_id;
+    entry->confidence = (float) state->confidenceScore;
+    entry->distance = (float) state->distance;
+    entry->orientation = (float) state->orientation;
+
+} /* End of OBJECT_Latest_Update */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  OBJECT_Latest_Clear_Track                                          */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Drops a deleted track from the table from the next cycle on        */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * *  * *  * * * * */
+void OBJECT_Latest_Clear_Track(OBJECT_Latest_t *latest, uint16 track_id){
+
+    if((track_id == 0) || (track_id > OBJECT_DICT_MAX_TRACKS)){
+        return;
+    }
+
+    memset(&latest->staging[track_id - 1], 0, sizeof(latest->staging[0]));
+
+} /* End of OBJECT_Latest_Clear_Track */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  OBJECT_Latest_Publish                                              */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Writes the staged tracks into the idle buffer and makes it the     */
+/*         one readers use                                                    */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * *  * *  * * * * */
+void OBJECT_Latest_Publish(OBJECT_Latest_t *latest, const OBJECT_Lifecycle_t *lifecycle,
+                           const OBJECT_Kinematics_Table_t *kinematics){
+    OBJECT_Latest_Buffer_t *buffer;
+    OBJECT_Latest_Entry_t *entry;
+    const OBJECT_Kinematics_Data_t *result;
+    uint32 target = 1 - latest->table.latest;
+    uint32 sequence;
+    uint32 count = 0;
+    uint16 itr;
+
+    buffer = &latest->table.buffers[target];
+    sequence = buffer->sequence;
+
+    // Odd before any entry changes
+    OBJECT_LATEST_STORE_RELEASE(&buffer->sequence, sequence + 1);
+    OBJECT_LATEST_FENCE_RELEASE();
+
+    for(itr = 0; itr < OBJECT_DICT_MAX_TRACKS; itr++){
+        if(latest->staging[itr].track_id == 0){
+            continue;
+        }
+
+        entry = &buffer->entries[count++];
+        *entry = latest->staging[itr];
+        entry->lifecycle_state = lifecycle->tracks[itr].state;
+
+        result = &kinematics->tracks[itr].result;
+        entry->kinematics_valid = result->valid;
+        entry->range_rate = result->valid ? result->range_rate : 0.0f;
+        entry->bearing_rate = result->valid ? result->bearing_rate : 0.0f;
+    }
+
+    buffer->track_count = count;
+    buffer->cycle = latest->cycle++;
+
+    OBJECT_LATEST_STORE_RELEASE(&buffer->sequence, sequence + 2);
+    OBJECT_LATEST_STORE_RELEASE(&latest->table.latest, target);
+
+} /* End of OBJECT_Latest_Publish */
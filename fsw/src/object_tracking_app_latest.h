@@ -0,0 +1,63 @@
+/*******************************************************************************
+**
+**      GSC-18128-1, "Core Flight Executive Version 6.7"
+**
+**      Copyright (c) 2006-2019 United States Government as represented by
+**      the Administrator of the National Aeronautics and Space Administration.
+**      All Rights Reserved.
+**
+**      Licensed under the Apache License, Version 2.0 (the "License");
+**      you may not use this file except in compliance with the License.
+**      You may obtain a copy of the License at
+**
+**        http://www.apache.org/licenses/LICENSE-2.0
+**
+**      Unless required by applicable law or agreed to in writing, software
+**      distributed under the License is distributed on an "AS IS" BASIS,
+**      WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**      See the License for the specific language governing permissions and
+**      limitations under the License.
+**
+**
+** File: object_tracking_app_latest.h
+**
+** Purpose:
+**   Writer of the shared latest-state table, see object_tracking_latest.h.
+**
+*******************************************************************************/
+
+#ifndef _object_tracking_app_latest_h_
+#define _object_tracking_app_latest_h_
+
+#include "cfe.h"
+
+#include "object_tracking_latest.h"
+#include "object_tracking_app_msg.h"
+#include "object_tracking_app_compact.h"
+#include "object_tracking_app_kinematics.h"
+#include "object_tracking_app_lifecycle.h"
+
+#if OBJECT_LATEST_MAX_TRACKS != OBJECT_DICT_MAX_TRACKS
+#error "OBJECT_LATEST_MAX_TRACKS must match OBJECT_DICT_MAX_TRACKS"
+#endif
+
+typedef struct
+{
+    // Shared with readers through the table registry
+    OBJECT_Latest_Table_t   table;
+    CFE_TBL_Handle_t        handle;
+
+    // Newest detection of every track since startup, indexed by track id - 1,
+    // 'track_id' 0 when the track has none
+    OBJECT_Latest_Entry_t   staging[OBJECT_DICT_MAX_TRACKS];
+
+    uint32                  cycle;
+} OBJECT_Latest_t;
+
+int32 OBJECT_Latest_Init(OBJECT_Latest_t *latest);
+void  OBJECT_Latest_Update(OBJECT_Latest_t *latest, uint16 track_id, const rover_state *state);
+void  OBJECT_Latest_Clear_Track(OBJECT_Latest_t *latest, uint16 track_id);
+void  OBJECT_Latest_Publish(OBJECT_Latest_t *latest, const OBJECT_Lifecycle_t *lifecycle,
+                            const OBJECT_Kinematics_Table_t *kinematics);
+
+#endif /* _object_tracking_app_latest_h_ */
@@ -0,0 +1,293 @@
+/*******************************************************************************
+**
+**      GSC-18128-1, "Core Flight Executive Version 6.7"
+**
+**      Copyright (c) 2006-2019 United States Government as represented by
+**      the Administrator of the National Aeronautics and Space Administration.
+**      All Rights Reserved.
+**
+**      Licensed under the Apache License, Version 2.0 (the "License");
+**      you may not use this file except in compliance with the License.
+**      You may obtain a copy of the License at
+**
+**        http://www.apache.org/licenses/LICENSE-2.0
+**
+**      Unless required by applicable law or agreed to in writing, software
+**      distributed under the License is distributed on an "AS IS" BASIS,
+**      WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**      See the License for the specific language governing permissions and
+**      limitations under the License.
+**
+**
+** File: object_tracking_app_lifecycle.c
+**
+** Purpose:
+**   Moves tracks through tentative, confirmed, coasting and deleted as
+**   they are observed or go quiet.
+**
+** Notes:
+**   Every live track has exactly one pending timeout in a hashed timer
+**   wheel. Advancing the wheel only visits the buckets of the elapsed
+**   ticks, so aging costs the expired tracks and not a scan of the table.
+**   Each dictionary partition has its own wheel, advanced by the shard
+**   owning the partition's classes.
+**
+*******************************************************************************/
+
+/*
+** Include Files:
+*/
+#include "object_tracking_app_lifecycle.h"
+
+// Timeouts in wheel ticks, rounded up
+#define OBJECT_MS_TO_TICKS(ms)                (((ms) + OBJECT_WHEEL_TICK_MS - 1) / OBJECT_WHEEL_TICK_MS)
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  OBJECT_Lifecycle_Init                                              */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Clears every track and bucket                                      */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * *  * *  * * * * */
+void OBJECT_Lifecycle_Init(OBJECT_Lifecycle_t *life, uint32 wheels){
+
+    memset(life, 0, sizeof(*life));
+
+    if(wheels < 1){
+        wheels = 1;
+    }
+    life->wheel_count = (wheels > OBJECT_DICT_PARTITIONS_MAX) ? OBJECT_DICT_PARTITIONS_MAX : wheels;
+
+} /* End of OBJECT_Lifecycle_Init */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  OBJECT_Lifecycle_Now                                               */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Current spacecraft time in wheel ticks                             */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * *  * *  * * * * */
+uint32 OBJECT_Lifecycle_Now(void){
+    CFE_TIME_SysTime_t now = CFE_TIME_GetTime();
+    uint64 msec;
+
+    msec = ((uint64) now.Seconds * 1000) + (CFE_TIME_Sub2MicroSecs(now.Subseconds) / 1000);
+
+    return((uint32) (msec / OBJECT_WHEEL_TICK_MS));
+
+} /* End of OBJECT_Lifecycle_Now */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  OBJECT_Wheel_Unlink                                                */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Removes a track from its bucket                                    */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * *  * *  * * * * */
+static void OBJECT_Wheel_Unlink(OBJECT_Lifecycle_t *life, OBJECT_Lifecycle_Wheel_t *wheel, uint16 track_id){
+    OBJECT_Track_Life_t *track = &life->tracks[track_id - 1];
+
+    if(track->wheel_prev != 0){
+        life->tracks[track->wheel_prev - 1].wheel_next = track->wheel_next;
+    } else {
+        wheel->wheel[track->expiry_tick % OBJECT_WHEEL_SLOTS] = track->wheel_next;
+    }
+
+    if(track->wheel_next != 0){
+        life->tracks[track->wheel_next - 1].wheel_prev = track->wheel_prev;
+    }
+
+    track->wheel_next = 0;
+    track->wheel_prev = 0;
+
+} /* End of OBJECT_Wheel_Unlink */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  OBJECT_Wheel_Schedule                                              */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Puts a track at the head of the bucket of its new timeout          */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * *  * *  * * * * */
+static void OBJECT_Wheel_Schedule(OBJECT_Lifecycle_t *life, OBJECT_Lifecycle_Wheel_t *wheel, uint16 track_id,
+                                  uint32 expiry_tick){
+    OBJECT_Track_Life_t *track = &life->tracks[track_id - 1];
+    uint16 *head = &wheel->wheel[expiry_tick % OBJECT_WHEEL_SLOTS];
+
+    track->expiry_tick = expiry_tick;
+    track->wheel_prev = 0;
+    track->wheel_next = *head;
+
+    if(*head != 0){
+        life->tracks[*head - 1].wheel_prev = track_id;
+    }
+    *head = track_id;
+
+} /* End of OBJECT_Wheel_Schedule */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  OBJECT_Lifecycle_Observe                                           */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Records an observation of a track, creating it as tentative,       */
+/*         confirming it after enough hits and reviving it from coasting      */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * *  * *  * * * * */
+void OBJECT_Lifecycle_Observe(OBJECT_Lifecycle_t *life, uint16 track_id, uint8 class_id, uint32 now){
+    OBJECT_Lifecycle_Wheel_t *wheel = &life->wheels[class_id % life->wheel_count];
+    OBJECT_Track_Life_t *track;
+
+    // Detections without a dictionary id aren't tracked
+    if((track_id == 0) || (track_id > OBJECT_DICT_MAX_TRACKS)){
+        return;
+    }
+
+    track = &life->tracks[track_id - 1];
+
+    switch(track->state){
+        case OBJECT_TRACK_FREE:
+            track->state = OBJECT_TRACK_TENTATIVE;
+            track->class_id = class_id;
+            track->hits = 0;
+            wheel->tentative_count++;
+            break;
+
+        case OBJECT_TRACK_COASTING:
+            OBJECT_Wheel_Unlink(life, wheel, track_id);
+            track->state = OBJECT_TRACK_CONFIRMED;
+            wheel->coasting_count--;
+            wheel->confirmed_count++;
+            break;
+
+        default:
+            OBJECT_Wheel_Unlink(life, wheel, track_id);
+            break;
+    }
+
+    if(track->hits < 0xFFFF){
+        track->hits++;
+    }
+
+    if((track->state == OBJECT_TRACK_TENTATIVE) && (track->hits >= OBJECT_TRACK_CONFIRM_HITS)){
+        track->state = OBJECT_TRACK_CONFIRMED;
+        wheel->tentative_count--;
+        wheel->confirmed_count++;
+    }
+
+    track->last_tick = now;
+    OBJECT_Wheel_Schedule(life, wheel, track_id, now + ((track->state == OBJECT_TRACK_TENTATIVE) ?
+                                                 OBJECT_MS_TO_TICKS(OBJECT_TRACK_TENTATIVE_MS) :
+                                                 OBJECT_MS_TO_TICKS(OBJECT_TRACK_COAST_MS)));
+
+} /* End of OBJECT_Lifecycle_Observe */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  OBJECT_Lifecycle_Expire                                            */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Handles a due timeout: confirmed tracks start coasting,            */
+/*         tentative and coasting tracks are deleted                          */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * *  * *  * * * * */
+static void OBJECT_Lifecycle_Expire(OBJECT_Lifecycle_t *life, OBJECT_Lifecycle_Wheel_t *wheel, uint16 track_id,
+                                    OBJECT_Track_Delete_Fn_t on_delete){
+    OBJECT_Track_Life_t *track = &life->tracks[track_id - 1];
+    uint8 class_id = track->class_id;
+
+    if(track->state == OBJECT_TRACK_CONFIRMED){
+        track->state = OBJECT_TRACK_COASTING;
+        wheel->confirmed_count--;
+        wheel->coasting_count++;
+
+        OBJECT_Wheel_Schedule(life, wheel, track_id, track->last_tick + OBJECT_MS_TO_TICKS(OBJECT_TRACK_DELETE_MS));
+        return;
+    }
+
+    if(track->state == OBJECT_TRACK_TENTATIVE){
+        wheel->tentative_count--;
+    } else {
+        wheel->coasting_count--;
+    }
+
+    memset(track, 0, sizeof(*track));
+    wheel->deleted_count++;
+
+    if(on_delete != NULL){
+        on_delete(track_id, class_id);
+    }
+
+} /* End of OBJECT_Lifecycle_Expire */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  OBJECT_Lifecycle_Advance                                           */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Called every cycle for every wheel. Visits the buckets of the      */
+/*         ticks elapsed since the last call (at most one lap) and expires    */
+/*         the due tracks in them                                             */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * *  * *  * * * * */
+void OBJECT_Lifecycle_Advance(OBJECT_Lifecycle_t *life, uint32 wheel_index, uint32 now,
+                              OBJECT_Track_Delete_Fn_t on_delete){
+    OBJECT_Lifecycle_Wheel_t *wheel = &life->wheels[wheel_index];
+    OBJECT_Track_Life_t *track;
+    uint32 steps;
+    uint32 itr;
+    uint16 track_id;
+    uint16 next_id;
+
+    if(!wheel->started){
+        wheel->started = true;
+        wheel->tick = now;
+        return;
+    }
+
+    // Time went backwards or didn't move
+    if((int32) (now - wheel->tick) <= 0){
+        return;
+    }
+
+    // A long stall visits every bucket once, the expiry check below is absolute
+    steps = now - wheel->tick;
+    if(steps > OBJECT_WHEEL_SLOTS){
+        steps = OBJECT_WHEEL_SLOTS;
+    }
+
+    for(itr = 1; itr <= steps; itr++){
+        track_id = wheel->wheel[(now - steps + itr) % OBJECT_WHEEL_SLOTS];
+
+        while(track_id != 0){
+            track = &life->tracks[track_id - 1];
+            next_id = track->wheel_next;
+
+            // Tracks due on a later lap stay in the bucket
+            if((int32) (track->expiry_tick - now) <= 0){
+                OBJECT_Wheel_Unlink(life, wheel, track_id);
+                OBJECT_Lifecycle_Expire(life, wheel, track_id, on_delete);
+            }
+
+            track_id = next_id;
+        }
+    }
+
+    wheel->tick = now;
+
+} /* End of OBJECT_Lifecycle_Advance */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  OBJECT_Lifecycle_Publishable                                       */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Tentative tracks are held back until confirmed. Detections         */
+/*         without a track id are always published.                           */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * *  * *  * * * * */
+bool OBJECT_Lifecycle_Publishable(const OBJECT_Lifecycle_t *life, uint16 track_id){
+
+    if((track_id == 0) || (track_id > OBJECT_DICT_MAX_TRACKS)){
+        return(true);
+    }
+
+    return(life->tracks[track_id - 1].state != OBJECT_TRACK_TENTATIVE);
+
+} /* End of OBJECT_Lifecycle_Publishable */
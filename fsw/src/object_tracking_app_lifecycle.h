@@ -0,0 +1,103 @@
+/*******************************************************************************
+**
+**      GSC-18128-1, "Core Flight Executive Version 6.7"
+**
+**      Copyright (c) 2006-2019 United States Government as represented by
+**      the Administrator of the National Aeronautics and Space Administration.
+**      All Rights Reserved.
+**
+**      Licensed under the Apache License, Version 2.0 (the "License");
+**      you may not use this file except in compliance with the License.
+**      You may obtain a copy of the License at
+**
+**        http://www.apache.org/licenses/LICENSE-2.0
+**
+**      Unless required by applicable law or agreed to in writing, software
+**      distributed under the License is distributed on an "AS IS" BASIS,
+**      WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**      See the License for the specific language governing permissions and
+**      limitations under the License.
+**
+**
+** File: object_tracking_app_lifecycle.h
+**
+** Purpose:
+**   Track lifecycle states and the hashed timer wheel that ages them.
+**
+*******************************************************************************/
+
+#ifndef _object_tracking_app_lifecycle_h_
+#define _object_tracking_app_lifecycle_h_
+
+#include "cfe.h"
+
+#include "object_tracking_app_compact.h"
+
+// Observations needed before a tentative track is published
+#define OBJECT_TRACK_CONFIRM_HITS             3
+
+// Time without an observation before a tentative track is deleted,
+// a confirmed track starts coasting and a coasting track is deleted
+#define OBJECT_TRACK_TENTATIVE_MS             1000
+#define OBJECT_TRACK_COAST_MS                 1500
+#define OBJECT_TRACK_DELETE_MS                10000
+
+// Timer wheel resolution and size (power of two).
+// Timeouts longer than one lap stay in their bucket for extra laps.
+#define OBJECT_WHEEL_TICK_MS                  50
+#define OBJECT_WHEEL_SLOTS                    256
+
+// Track states
+#define OBJECT_TRACK_FREE                     0
+#define OBJECT_TRACK_TENTATIVE                1
+#define OBJECT_TRACK_CONFIRMED                2
+#define OBJECT_TRACK_COASTING                 3
+
+// Lifecycle of one track, the wheel links are track ids (0 ends a bucket)
+typedef struct
+{
+    uint8       state;
+    uint8       class_id;
+    uint16      hits;
+    uint32      last_tick;
+    uint32      expiry_tick;
+    uint16      wheel_next;
+    uint16      wheel_prev;
+} OBJECT_Track_Life_t;
+
+// Called for every track the wheel deletes
+typedef void (*OBJECT_Track_Delete_Fn_t)(uint16 track_id, uint8 class_id);
+
+// Timer wheel of the tracks of one dictionary partition
+typedef struct
+{
+    // Bucket heads, a track sits in bucket 'expiry_tick % OBJECT_WHEEL_SLOTS'
+    uint16                  wheel[OBJECT_WHEEL_SLOTS];
+    uint32                  tick;
+    bool                    started;
+
+    // Tracks per state and tracks deleted since the last reset
+    uint16                  tentative_count;
+    uint16                  confirmed_count;
+    uint16                  coasting_count;
+    uint32                  deleted_count;
+} OBJECT_Lifecycle_Wheel_t;
+
+typedef struct
+{
+    // Indexed by track id - 1, same ids as the compact dictionary
+    OBJECT_Track_Life_t         tracks[OBJECT_DICT_MAX_TRACKS];
+
+    // Class 'c' ages on wheel 'c % wheel_count', like its dictionary partition,
+    // so the shard owning the class is the only one changing it
+    OBJECT_Lifecycle_Wheel_t    wheels[OBJECT_DICT_PARTITIONS_MAX];
+    uint32                      wheel_count;
+} OBJECT_Lifecycle_t;
+
+void   OBJECT_Lifecycle_Init(OBJECT_Lifecycle_t *life, uint32 wheels);
+uint32 OBJECT_Lifecycle_Now(void);
+void   OBJECT_Lifecycle_Observe(OBJECT_Lifecycle_t *life, uint16 track_id, uint8 class_id, uint32 now);
+void   OBJECT_Lifecycle_Advance(OBJECT_Lifecycle_t *life, uint32 wheel, uint32 now, OBJECT_Track_Delete_Fn_t on_delete);
+bool   OBJECT_Lifecycle_Publishable(const OBJECT_Lifecycle_t *life, uint16 track_id);
+
+#endif /* _object_tracking_app_lifecycle_h_ */
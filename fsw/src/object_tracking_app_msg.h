@@ -30,10 +30,16 @@
 #ifndef _object_tracker_msg_h_
 #define _object_tracker_msg_h_
 
+// Complete history encodings (OBJECT_HISTORY_ENCODING_*)
+#include "object_tracking_history_codec.h"
+
+// rover_state storage held by the history nodes
+#include "sync_node_lib.h"
+
 // Maximum amount of objects to track.
 // The index position matches the 'class_id', this allows for O(1) access due to basic hashing
+// History length is bounded by the shared sample budget (object_tracking_app_pool.h)
 #define MAX_OBJECT_TRACKING                   10  
-#define MAX_LINKED_LIST_LEN                   50
 
 /*
 ** TALKER App command codes
@@ -43,6 +49,49 @@
 #define OBJECT_TRACKER_PROCESS_CC              2
 #define OBJECT_TRACKER_SWITCH_CC               3
 #define OBJECT_TRACKER_COMPLETE_CC             4
+#define OBJECT_TRACKER_FORMAT_CC               5
+#define OBJECT_TRACKER_PRIORITY_CC             6
+#define OBJECT_TRACKER_PREDICT_CC              7
+#define OBJECT_TRACKER_LATENCY_SLA_CC          8
+#define OBJECT_TRACKER_WINDOW_QUERY_CC         9
+#define OBJECT_TRACKER_WINDOW_CONFIG_CC        10
+#define OBJECT_TRACKER_PUBLISH_RATE_CC         11
+#define OBJECT_TRACKER_PUBLISH_BUDGET_CC       12
+#define OBJECT_TRACKER_SUBSCRIBE_CC            13
+#define OBJECT_TRACKER_FUSE_CONFIG_CC          14
+#define OBJECT_TRACKER_EXPORT_CC               15
+#define OBJECT_TRACKER_HISTORY_SINCE_CC        16
+
+// Essentials telemetry wire formats
+#define OBJECT_ESS_FORMAT_FULL                 0  /* One 'OBJECT_State_t' per sample */
+#define OBJECT_ESS_FORMAT_COMPACT              1  /* Fixed-point 'OBJECT_Compact_State_t' batches */
+
+// Objects per compact essentials packet and entries per dictionary packet
+#define OBJECT_COMPACT_MAX_OBJECTS             32
+#define OBJECT_DICT_MAX_ENTRIES                16
+
+// 3D keypoints per detection ('keypoint_3D_listing' in 'rover_state')
+#define OBJECT_KEYPOINT_COUNT                  10
+
+// Encoded bytes carried by one complete history packet
+#define OBJECT_HISTORY_DATA_SIZE               1024
+
+// Tracks per prediction packet, and the prediction request class for all classes
+#define OBJECT_PREDICT_MAX_ENTRIES             16
+#define OBJECT_PREDICT_ALL_CLASSES             0xFF
+
+// Pipeline stages timed for every published sample
+#define OBJECT_LATENCY_STAGE_PARSE             0  /* Frame arrival to decoded */
+#define OBJECT_LATENCY_STAGE_INSERT            1  /* Decoded to stored in the history */
+#define OBJECT_LATENCY_STAGE_QUEUE             2  /* Stored to published */
+#define OBJECT_LATENCY_STAGE_AGE               3  /* Detection timestamp to published */
+#define OBJECT_LATENCY_STAGES                  4
+
+// Statistics entries per summary packet
+#define OBJECT_STATS_MAX_ENTRIES               16
+
+// Sliding-window aggregate entries per packet
+#define OBJECT_WINDOW_MAX_ENTRIES              16
 
 /*************************************************************************/
 
@@ -77,6 +126,51 @@ typedef struct
     uint8              CommandErrorCounter;
     uint8              CommandCounter;
     uint8              spare[2];
+
+    // Frames committed from the ingest transport, frames lost to overruns
+    // and frames rejected as malformed
+    uint32             IngestFrameCount;
+    uint32             IngestOverrunCount;
+    uint32             IngestMalformedCount;
+
+    // Live tracks per lifecycle state, tracks deleted after going quiet
+    // and unused history nodes
+    uint16             TrackTentativeCount;
+    uint16             TrackConfirmedCount;
+    uint16             TrackCoastingCount;
+    uint16             spare2;
+    uint32             TrackDeletedCount;
+    uint32             SamplePoolFreeCount;
+    uint32             SamplePoolEmptyCount;
+    uint32             SamplePoolReserveCount;
+
+    // Samples evicted to stay within the sample budget, in total and per class
+    uint32             SampleEvictedCount;
+    uint32             ClassEvictedCount[MAX_OBJECT_TRACKING];
+
+    // Class turns the output scheduler postponed, and samples it dropped
+    uint32             PublishDeferredCount;
+    uint32             PublishDroppedCount;
+
+    // Samples left unpublished by the subscription filter
+    uint32             FilteredSampleCount;
+
+    // Same-frame duplicate detections merged into another at ingest
+    uint32             FusedDetectionCount;
+
+    // Bulk requests answered by an equal queued one, and refused on a full queue
+    uint32             BulkCoalescedCount;
+    uint32             BulkRejectedCount;
+
+    // History files written, and exports that failed
+    uint32             ExportCount;
+    uint32             ExportErrorCount;
+
+    // Processed ingest files deleted or archived, files that could not be,
+    // and the bytes deleting them freed
+    uint32             RetiredFileCount;
+    uint32             RetireErrorCount;
+    uint64             RetiredBytesReclaimed;
 } OBJECT_HkTlm_Payload_t;
 
 typedef struct
@@ -124,103 +218,512 @@ typedef struct
     char        object_id[10];
     double      distance;
     double      orientation;
-    // Maybe keypoints-2D as well
-    //keypoint3D   keypoint_3D_listing[10];
+    // Raw keypoints stay onboard, their geometry is sent in 'OBJECT_Pose_Data_t'
 } OBJECT_Essentials_Data_t;
 
+// Motion of one track derived at ingest from its consecutive observations
+typedef struct
+{
+    // 0 until the track has a recent previous observation
+    uint8       valid;
+    uint8       spare[3];
+
+    // Meters per second, negative while closing
+    float       range_rate;
+
+    // Degrees per second
+    float       bearing_rate;
+
+    // Meters per second in the sensor plane, x along orientation 0
+    float       velocity[2];
+
+    // Seconds until the range reaches 0 at the current range rate, -1 when not closing
+    float       time_to_contact;
+} OBJECT_Kinematics_Data_t;
+
+// Geometry derived from the 3D keypoints of one detection
+typedef struct
+{
+    // Keypoints that were present (non-zero)
+    uint8       keypoint_count;
+    uint8       spare[3];
+
+    float       centroid[3];
+    float       extent_min[3];
+    float       extent_max[3];
+
+    // Direction of centroid travel in the x-y plane since the previous sample, degrees
+    float       heading;
+
+    // Per-keypoint travel since the previous sample, 0 when either is missing
+    float       displacement[OBJECT_KEYPOINT_COUNT];
+} OBJECT_Pose_Data_t;
+
+// Predicted state of one track at a requested time
+typedef struct
+{
+    uint16      track_id;
+    uint8       class_id;
+
+    // 0 when the track has no motion estimate or the horizon is too long,
+    // the last observation is reported instead
+    uint8       valid;
+
+    // Seconds from the track's last observation to the predicted time
+    float       horizon;
+
+    float       distance;
+    float       orientation;
+
+    // One sigma uncertainty of 'distance' (m) and 'orientation' (deg)
+    float       distance_sigma;
+    float       orientation_sigma;
+} OBJECT_Prediction_Data_t;
+
 // Object Tracking essentials message 
+// 'prediction' and 'pose' are enabled with OBJECT_TRACKER_FORMAT_CC. The message
+// ends after the last enabled block, a disabled block before it is zeroed.
 typedef struct
 {
     CFE_SB_Msg_t                MsgHdr;
     OBJECT_Essentials_Data_t    payload;
+
+    // Microseconds from the detection timestamp to publication
+    uint32                      age_us;
+    uint32                      spare;
+
+    OBJECT_Kinematics_Data_t    kinematics;
+    OBJECT_Prediction_Data_t    prediction;
+    OBJECT_Pose_Data_t          pose;
 } OBJECT_State_t;
 
 
 
-// Message contains header node
-// This allows for complete traversal of the object historys movement
+// Compact essentials - one detection in fixed point
+// The names behind 'track_id' and 'class_id' are sent in 'OBJECT_Dict_t'
 typedef struct
 {
-    // The head node in the object linked list history
-    // The user can iterate over the nodes for the full object detection history
-    Object_Master_Node_t object_master_node;
+    uint16      track_id;           /* 0 when the dictionary is full */
+    uint8       class_id;
+    uint8       confidence;         /* Percent, 0-100 */
+    uint32      distance_mm;
+    uint16      orientation_cdeg;   /* Centi-degrees, 0-35999 */
+    int16       time_offset_ms;     /* From the packet timestamp */
+    int16       range_rate_cmps;    /* Centimeters per second, negative while closing */
+    uint16      time_to_contact_ds; /* Deciseconds, 0xFFFF when not closing or unknown */
+} OBJECT_Compact_Object_t;
 
-} OBJECT_Complete_Data_t;
+typedef struct
+{
+    // Timestamp of the first object in the packet
+    uint32                      timeStamp_sec;
+    uint32                      timeStamp_nanoSec;
 
-// Object-Tracking complete history
-// Sends the buffer pointer over, this prevents copying over
+    uint16                      object_count;
+
+    // Dictionary version the track ids refer to
+    uint16                      dict_version;
+
+    // Microseconds from the packet timestamp to publication,
+    // an object's age is this minus its 'time_offset_ms'
+    uint32                      age_us;
+
+    OBJECT_Compact_Object_t     objects[OBJECT_COMPACT_MAX_OBJECTS];
+} OBJECT_Compact_State_Payload_t;
+
+// Compact essentials message, only 'object_count' objects are sent
 typedef struct
 {
-    CFE_SB_Buffer_t           objectSBBuf;
-    OBJECT_Complete_Data_t    payload;
-} OBJECT_history_App_Header_t;
+    uint8                           TlmHeader[CFE_SB_TLM_HDR_SIZE];
+    OBJECT_Compact_State_Payload_t  Payload;
 
+} OS_PACK OBJECT_Compact_State_t;
 
+// Name dictionary entry for one numeric track id
+typedef struct
+{
+    uint16      track_id;
+    uint8       class_id;
+    uint8       spare;
+    char        class_name[10];
+    char        object_id[10];
+} OBJECT_Dict_Entry_t;
 
-// TO-DO: USE GENERICS AND MACROS FOR UNIFORM MESSAGE HEADER
-// Used for requesting the publication of an object's state on the software bus.
 typedef struct
 {
-    // The ojects annotation id number
+    uint16                      dict_version;
+    uint16                      first_entry;
+    uint16                      entry_count;
+    uint16                      total_entries;
+    OBJECT_Dict_Entry_t         entries[OBJECT_DICT_MAX_ENTRIES];
+} OBJECT_Dict_Payload_t;
+
+// Low-rate name dictionary message, paged by 'first_entry'
+typedef struct
+{
+    uint8                       TlmHeader[CFE_SB_TLM_HDR_SIZE];
+    OBJECT_Dict_Payload_t       Payload;
+
+} OS_PACK OBJECT_Dict_t;
+
+typedef struct
+{
+    // cFE time the states are predicted for
+    uint32                      seconds;
+    uint32                      subseconds;
+
+    uint16                      first_entry;
+    uint16                      total_entries;
+    uint16                      entry_count;
+    uint16                      spare;
+    OBJECT_Prediction_Data_t    entries[OBJECT_PREDICT_MAX_ENTRIES];
+} OBJECT_Prediction_Payload_t;
+
+// Prediction reply, paged by 'first_entry', only 'entry_count' entries are sent
+typedef struct
+{
+    uint8                       TlmHeader[CFE_SB_TLM_HDR_SIZE];
+    OBJECT_Prediction_Payload_t Payload;
+
+} OS_PACK OBJECT_Prediction_Packet_t;
+
+// Sets the p99 latency above which OBJECT_LATENCY_SLA_ERR_EID is raised
+typedef struct
+{
+    uint8                       CmdHeader[CFE_SB_CMD_HDR_SIZE];
+
+    // Microseconds of detection-to-publish age, 0 disables the check
+    uint32                      sla_p99_us;
+} OBJECT_Latency_Sla_t;
+
+// Percentiles of one stage over the rolling window, microseconds
+typedef struct
+{
+    uint32      p50_us;
+    uint32      p95_us;
+    uint32      p99_us;
+    uint32      max_us;
+} OBJECT_Latency_Stage_t;
+
+typedef struct
+{
+    // Samples in the window
+    uint32                      sample_count;
+
+    uint32                      sla_p99_us;
+    uint32                      sla_violation_count;
+    uint8                       sla_violated;
+    uint8                       spare[3];
+
+    // Indexed by OBJECT_LATENCY_STAGE_*
+    OBJECT_Latency_Stage_t      stages[OBJECT_LATENCY_STAGES];
+} OBJECT_Latency_Payload_t;
+
+// Rolling pipeline latency percentiles
+typedef struct
+{
+    uint8                       TlmHeader[CFE_SB_TLM_HDR_SIZE];
+    OBJECT_Latency_Payload_t    Payload;
+
+} OS_PACK OBJECT_Latency_Packet_t;
+
+// Running statistics of one class (track_id 0) or one track
+typedef struct
+{
+    uint16      track_id;
     uint8       class_id;
+    uint8       spare;
 
-    // Switch state to turn 'on' or 'off' the 'enable_switch' CMD struct variable
-    bool        switchCMD;
+    // Detections since startup, and per second since the previous summary
+    uint32      count;
+    float       rate_hz;
 
-} OBJECT_Switch_t;
+    // Milliseconds since the last detection
+    uint32      last_seen_ms;
+
+    float       confidence_mean;
+    float       confidence_stddev;
+    float       confidence_min;
+    float       confidence_max;
+
+    float       distance_mean;
+    float       distance_stddev;
+    float       distance_min;
+    float       distance_max;
+} OBJECT_Stats_Entry_t;
 
-// Switch message app-to-app header
 typedef struct
 {
-    CFE_SB_Msg_t                MsgHdr;
-    OBJECT_Switch_t             payload;
-} OBJECT_Switch_App_Header_t;
+    uint16                      first_entry;
+    uint16                      total_entries;
+    uint16                      entry_count;
+    uint16                      spare;
+    OBJECT_Stats_Entry_t        entries[OBJECT_STATS_MAX_ENTRIES];
+} OBJECT_Stats_Payload_t;
+
+// Low-rate statistics summary, classes first then tracks, paged by 'first_entry'
+typedef struct
+{
+    uint8                       TlmHeader[CFE_SB_TLM_HDR_SIZE];
+    OBJECT_Stats_Payload_t      Payload;
 
-// Switch message ground-to-app header
+} OS_PACK OBJECT_Stats_Packet_t;
+
+// Asks for the sliding-window aggregates of one track, a class or everything
 typedef struct
 {
     uint8                       CmdHeader[CFE_SB_CMD_HDR_SIZE];
-    OBJECT_Switch_t             payload;
-} OBJECT_Switch_GCS_Header_t;
 
+    // Single class or OBJECT_PREDICT_ALL_CLASSES
+    uint8                       class_id;
+    uint8                       spare;
 
+    // Single track, 0 for every track of 'class_id'
+    uint16                      track_id;
+} OBJECT_Window_Query_t;
 
-// TO-DO: USE GENERICS AND MACROS FOR UNIFORM MESSAGE HEADER
-// Used for requesting the COMPLETE publication hsitory of an object's state on the software bus.
+// Sets the publish priority and maximum publish rate of a class
 typedef struct
 {
-    // The ojects annotation id number
+    uint8                       CmdHeader[CFE_SB_CMD_HDR_SIZE];
+    uint8                       class_id;
+
+    // Classes at OBJECT_SCHED_PRIORITY_ALWAYS or above skip the cycle budget
+    uint8                       priority;
+    uint8                       spare[2];
+
+    // Samples per 1000 seconds (mHz), 0 for no limit
+    uint32                      max_rate_mhz;
+} OBJECT_Publish_Rate_t;
+
+// Sets the output scheduler budget of every cycle
+typedef struct
+{
+    uint8                       CmdHeader[CFE_SB_CMD_HDR_SIZE];
+    uint16                      max_msgs;
+    uint16                      spare;
+    uint32                      max_bytes;
+} OBJECT_Publish_Budget_t;
+
+// Bit 'class_id' of the mask covers every label a uint8 class id can name
+#define OBJECT_SUBSCRIBE_MASK_WORDS            (256 / 32)
+
+// Replaces the publish subscription in one command
+typedef struct
+{
+    uint8                       CmdHeader[CFE_SB_CMD_HDR_SIZE];
+
+    // Bit (class_id % 32) of word (class_id / 32) enables a class
+    uint32                      class_mask[OBJECT_SUBSCRIBE_MASK_WORDS];
+
+    // Same scale as 'confidenceScore', 0 to publish every detection
+    float                       min_confidence;
+
+    // Meters, 'max_distance' 0 for no upper limit
+    float                       min_distance;
+    float                       max_distance;
+} OBJECT_Subscribe_t;
+
+// Sets the gate of same-frame duplicate fusion
+typedef struct
+{
+    uint8                       CmdHeader[CFE_SB_CMD_HDR_SIZE];
+
+    // Meters and degrees, a 'distance_gate' of 0 turns fusion off
+    float                       distance_gate;
+    float                       orientation_gate;
+} OBJECT_Fuse_Config_t;
+
+// Writes class histories to a file for file-based downlink
+typedef struct
+{
+    uint8                       CmdHeader[CFE_SB_CMD_HDR_SIZE];
+    char                        filename[OS_MAX_PATH_LEN];
+
+    // Single class or OBJECT_PREDICT_ALL_CLASSES
+    uint8                       class_id;
+    uint8                       spare[3];
+
+    // Detection seconds, inclusive, 'end_sec' 0 for no upper bound
+    uint32                      start_sec;
+    uint32                      end_sec;
+} OBJECT_Export_History_t;
+
+// Complete history request that skips what the consumer already holds
+typedef struct
+{
+    uint8                       CmdHeader[CFE_SB_CMD_HDR_SIZE];
+    uint8                       class_id;
+
+    // History packet encoding (OBJECT_HISTORY_ENCODING_*)
+    uint8                       encoding;
+    uint8                       spare[2];
+
+    // Only samples stored after this sequence, 0 for every sample
+    uint32                      since_sequence;
+
+    // Not-modified reply when the history still has this version, 0 to always reply
+    uint32                      if_version;
+} OBJECT_History_Since_t;
+
+// Sets the sliding-window length and whether aggregates are published every cycle
+typedef struct
+{
+    uint8                       CmdHeader[CFE_SB_CMD_HDR_SIZE];
+    uint32                      window_ms;
+    uint8                       publish;
+    uint8                       spare[3];
+} OBJECT_Window_Config_t;
+
+// Aggregates of one track over the last 'window_ms' of detections
+typedef struct
+{
+    uint16      track_id;
     uint8       class_id;
 
-    // Switch state to turn 'on' or 'off' the 'enable_switch' CMD struct variable
-    bool        switchCMD;
+    // 1 when the window held more samples than are kept, the oldest are left out
+    uint8       saturated;
 
-} OBJECT_Switch_t;
+    uint32      count;
+    float       min_distance;
+    float       max_distance;
+    float       max_confidence;
+} OBJECT_Window_Entry_t;
 
-// Switch message app-to-app header
 typedef struct
 {
-    CFE_SB_Msg_t                MsgHdr;
+    uint32                      window_ms;
+    uint16                      first_entry;
+    uint16                      total_entries;
+    uint16                      entry_count;
+    uint16                      spare;
+    OBJECT_Window_Entry_t       entries[OBJECT_WINDOW_MAX_ENTRIES];
+} OBJECT_Window_Payload_t;
+
+// Sliding-window aggregates, paged by 'first_entry'
+typedef struct
+{
+    uint8                       TlmHeader[CFE_SB_TLM_HDR_SIZE];
+    OBJECT_Window_Payload_t     Payload;
+
+} OS_PACK OBJECT_Window_Packet_t;
+
+// One packet of a complete object history
+// RAW:   'data' holds 'sample_count' OBJECT_Essentials_Data_t
+// DELTA: 'data' holds 'sample_count' samples, see object_tracking_history_codec.h
+typedef struct
+{
     uint8                       class_id;
-} OBJECT_Switch_COM_App_t;
+    uint8                       encoding;
+    uint16                      packet_index;
+    uint16                      sample_count;
+    uint16                      data_length;
 
-// Switch message ground-to-app header
+    // Set on the final packet of the history
+    uint8                       last_packet;
+
+    // Set on a single empty packet when the history still has the version asked about
+    uint8                       not_modified;
+    uint8                       spare[2];
+
+    // Class history version and newest sample sequence when the reply was taken,
+    // 'last_sequence' is the 'since_sequence' of the next delta request
+    uint32                      version;
+    uint32                      last_sequence;
+
+    uint8                       data[OBJECT_HISTORY_DATA_SIZE];
+} OBJECT_History_Payload_t;
+
+// Complete history message, only 'data_length' bytes of 'data' are sent
+typedef struct
+{
+    uint8                       TlmHeader[CFE_SB_TLM_HDR_SIZE];
+    OBJECT_History_Payload_t    Payload;
+
+} OS_PACK OBJECT_History_Packet_t;
+
+// Selects the essentials wire format (OBJECT_ESS_FORMAT_*)
+typedef struct
+{
+    uint8                       CmdHeader[CFE_SB_CMD_HDR_SIZE];
+    uint8                       format;
+
+    // Appends keypoint geometry to full format essentials when set
+    uint8                       include_pose;
+
+    // Appends each track's state predicted to the publish time when set
+    uint8                       include_prediction;
+    uint8                       spare;
+} OBJECT_Format_t;
+
+// Sets the eviction priority of one class
 typedef struct
 {
     uint8                       CmdHeader[CFE_SB_CMD_HDR_SIZE];
     uint8                       class_id;
-} OBJECT_Switch_COM_GCS_t;
 
+    // Higher priorities keep their samples longer
+    uint8                       priority;
+    uint8                       spare[2];
+} OBJECT_Priority_t;
+
+// Requests every confirmed or coasting track's state predicted to a cFE time
+typedef struct
+{
+    uint8                       CmdHeader[CFE_SB_CMD_HDR_SIZE];
+
+    // cFE time to predict for, 0/0 for the time the command is processed
+    uint32                      seconds;
+    uint32                      subseconds;
 
+    // Single class or OBJECT_PREDICT_ALL_CLASSES
+    uint8                       class_id;
+    uint8                       spare[3];
+} OBJECT_Predict_t;
 
-// Tracks all the ojects in YOLO model, each element contains a linked list with a history of sightings 
-// The index position matches the 'class_id', this allows for O(1) access due to basic hashing
-typedef union
+
+
+// Pipeline timestamps of a sample, microseconds of cFE time
+typedef struct
 {
-    // Array used for tracking YOLO object detections 
-    Object_Master_Node_t object_list[MAX_OBJECT_TRACKING];
+    uint64          arrival_us;     /* Transport handed over the frame */
+    uint64          parsed_us;      /* Frame decoded into a 'rover_array' */
+    uint64          inserted_us;    /* Sample linked into its history */
+} OBJECT_Latency_Trace_t;
 
-} Object_Master_List_t;
+// Object-node - holds the rover data and neighbor nodes
+// Nodes are taken from the sample pool and returned to it when evicted
+// TO-DO: Will make into MACRO later so it can hold multiple types of data and cJSON structs.
+typedef struct Object_Node Object_Node_t;
+struct Object_Node
+{
+    // The raw saved data from cJSON ROS2-YOLO file 
+    rover_state     object_state;
+    
+    // The neighboring object state nodes
+    Object_Node_t   *previous_node;
+    Object_Node_t   *next_node;
+
+    // Tracks if it has been published on the software bus yet
+    bool            beenPublished;
+
+    // Order the sample was stored in its class, from 1
+    uint32          sequence;
+
+    // Dictionary track id of the sample, 0 when the dictionary was full
+    uint16          track_id;
+
+    // When the sample went through each ingest stage
+    OBJECT_Latency_Trace_t trace;
+
+    // Snapshot epochs the node was linked, removed (0 while live) and
+    // unlinked in, and its link in the deferred reclaim queues
+    uint32          born_epoch;
+    uint32          dead_epoch;
+    uint32          unlinked_epoch;
+    Object_Node_t   *retired_next;
+    
+};
 
 // Object Tracking header node
 typedef struct
@@ -239,23 +742,102 @@ typedef struct
     // Used for easier iterating and maxed linked list checking
     int total_node_len;
 
+    // Eviction order when the sample budget is hit: lowest priority first,
+    // then the least recently updated class
+    uint8  priority;
+    uint32 last_update;
+
+    // Samples of this class evicted to stay within the budget
+    uint32 evicted_count;
+
+    // Sequence of the newest stored sample, and a version bumped by every
+    // sample stored or removed
+    uint32 last_sequence;
+    uint32 version;
+
 } Object_Master_Node_t;
 
-// Object-node - holds the rover data and neighbor nodes
-// TO-DO: Will make into MACRO later so it can hold multiple types of data and cJSON structs.
-typedef struct 
+// Tracks all the ojects in YOLO model, each element contains a linked list with a history of sightings 
+// The index position matches the 'class_id', this allows for O(1) access due to basic hashing
+typedef union
 {
-    // The raw saved data from cJSON ROS2-YOLO file 
-    rover_state     object_state;
-    
-    // The neighboring object state nodes
-    Object_Node_t   *previous_node;
-    Object_Node_t   *next_node;
+    // Array used for tracking YOLO object detections 
+    Object_Master_Node_t object_list[MAX_OBJECT_TRACKING];
+
+} Object_Master_List_t;
+
+
+
+// Message contains header node
+// This allows for complete traversal of the object historys movement
+typedef struct
+{
+    // The head node in the object linked list history
+    // The user can iterate over the nodes for the full object detection history
+    Object_Master_Node_t object_master_node;
+
+} OBJECT_Complete_Data_t;
+
+// Object-Tracking complete history
+// Sends the buffer pointer over, this prevents copying over
+typedef struct
+{
+    CFE_SB_Buffer_t           objectSBBuf;
+    OBJECT_Complete_Data_t    payload;
+} OBJECT_history_App_Header_t;
+
+
+
+// TO-DO: USE GENERICS AND MACROS FOR UNIFORM MESSAGE HEADER
+// Used for requesting the publication of an object's state on the software bus.
+typedef struct
+{
+    // The ojects annotation id number
+    uint8       class_id;
+
+    // Switch state to turn 'on' or 'off' the 'enable_switch' CMD struct variable
+    bool        switchCMD;
+
+} OBJECT_Switch_t;
+
+// Switch message app-to-app header
+typedef struct
+{
+    CFE_SB_Msg_t                MsgHdr;
+    OBJECT_Switch_t             payload;
+} OBJECT_Switch_App_Header_t;
+
+// Switch message ground-to-app header
+typedef struct
+{
+    uint8                       CmdHeader[CFE_SB_CMD_HDR_SIZE];
+    OBJECT_Switch_t             payload;
+} OBJECT_Switch_GCS_Header_t;
+
+
+
+// TO-DO: USE GENERICS AND MACROS FOR UNIFORM MESSAGE HEADER
+// Used for requesting the COMPLETE publication hsitory of an object's state on the software bus.
+// Switch message app-to-app header
+typedef struct
+{
+    CFE_SB_Msg_t                MsgHdr;
+    uint8                       class_id;
+
+    // History packet encoding (OBJECT_HISTORY_ENCODING_*)
+    uint8                       encoding;
+} OBJECT_Switch_COM_App_t;
+
+// Switch message ground-to-app header
+typedef struct
+{
+    uint8                       CmdHeader[CFE_SB_CMD_HDR_SIZE];
+    uint8                       class_id;
+
+    // History packet encoding (OBJECT_HISTORY_ENCODING_*)
+    uint8                       encoding;
+} OBJECT_Switch_COM_GCS_t;
 
-    // Tracks if it has been published on the software bus yet
-    bool            beenPublished;
-    
-} Object_Node_t;
 
 
 #endif /* _object_tracker_msg_h_ */
@@ -0,0 +1,213 @@
+/*******************************************************************************
+**
+**      GSC-18128-1, "Core Flight Executive Version 6.7"
+**
+**      Copyright (c) 2006-2019 United States Government as represented by
+**      the Administrator of the National Aeronautics and Space Administration.
+**      All Rights Reserved.
+**
+**      Licensed under the Apache License, Version 2.0 (the "License");
+**      you may not use this file except in compliance with the License.
+**      You may obtain a copy of the License at
+**
+**        http://www.apache.org/licenses/LICENSE-2.0
+**
+**      Unless required by applicable law or agreed to in writing, software
+**      distributed under the License is distributed on an "AS IS" BASIS,
+**      WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**      See the License for the specific language governing permissions and
+**      limitations under the License.
+**
+**
+** File: object_tracking_app_parse.c
+**
+** Purpose:
+**   Parses pending 'Output_N' files on worker tasks and commits them in order.
+**
+*******************************************************************************/
+
+/*
+** Include Files:
+*/
+#include <stdio.h>
+
+#include "object_tracking_app.h"
+
+extern OBJECT_TrackerData_t OBJECT_TrackerData;
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  OBJECT_Parse_Path                                                  */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Path of the 'Output_N' file number 'file_num'                      */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * *  * *  * * * * */
+static void OBJECT_Parse_Path(char *path, size_t size, int file_num){
+
+    snprintf(path, size, "%sOutput_%d", ROS2_FILE_LOC, file_num);
+
+} /* End of OBJECT_Parse_Path */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  OBJECT_Parse_Task                                                  */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Parse worker entry point. Takes the queued files in the order      */
+/*         they were queued and marks each slot done once parsed.             */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * *  * *  * * * * */
+static void OBJECT_Parse_Task(void){
+    OBJECT_Parse_Pool_t *pool = &OBJECT_TrackerData.ParsePool;
+    OBJECT_Parse_Slot_t *slot;
+    char fileLoc[100];
+
+    if(CFE_ES_RegisterChildTask() != CFE_SUCCESS){
+        return;
+    }
+
+    while(OS_CountSemTake(pool->work_sem_id) == OS_SUCCESS){
+
+        // One count per queued slot, so the claimed slot is always queued
+        OS_MutSemTake(pool->mutex_id);
+        slot = &pool->slots[pool->next_claim % OBJECT_PARSE_SLOTS];
+        pool->next_claim++;
+        OS_MutSemGive(pool->mutex_id);
+
+        OBJECT_EPOCH_STORE_RELEASE(&slot->state, OBJECT_PARSE_SLOT_BUSY);
+
+        OBJECT_Parse_Path(fileLoc, sizeof(fileLoc), slot->file_num);
+        sync_fusion_injest(&slot->rovers, fileLoc);
+        slot->trace.parsed_us = OBJECT_Latency_Now();
+
+        // Publishes the frame to the main task
+        OBJECT_EPOCH_STORE_RELEASE(&slot->state, OBJECT_PARSE_SLOT_DONE);
+    }
+
+    CFE_ES_ExitChildTask();
+
+} /* End of OBJECT_Parse_Task */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  OBJECT_Parse_Init                                                  */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Creates the work queue and starts the parse workers.               */
+/*         'first_file' is the first file number to parse.                    */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * *  * *  * * * * */
+int32 OBJECT_Parse_Init(OBJECT_Parse_Pool_t *pool, uint32 workers, int first_file){
+    char   taskName[OS_MAX_API_NAME];
+    int32  status;
+    uint32 itr;
+
+    memset(pool, 0, sizeof(*pool));
+    pool->next_dispatch = first_file;
+    pool->next_claim = first_file;
+    pool->next_commit = first_file;
+
+    if(workers > OBJECT_PARSE_WORKERS_MAX){
+        workers = OBJECT_PARSE_WORKERS_MAX;
+    }
+
+    status = OS_MutSemCreate(&pool->mutex_id, "OBJECT_PARSE_MUT", 0);
+    if(status != OS_SUCCESS){
+        return(status);
+    }
+
+    status = OS_CountSemCreate(&pool->work_sem_id, "OBJECT_PARSE_SEM", 0, 0);
+    if(status != OS_SUCCESS){
+        return(status);
+    }
+
+    for(itr = 0; itr < workers; itr++){
+        snprintf(taskName, sizeof(taskName), "OBJECT_PARSE_%lu", (unsigned long) itr);
+
+        status = CFE_ES_CreateChildTask(&pool->task_ids[itr],
+                                        taskName,
+                                        OBJECT_Parse_Task,
+                                        NULL,
+                                        OBJECT_PARSE_TASK_STACK,
+                                        OBJECT_PARSE_TASK_PRIORITY,
+                                        0);
+        if(status != CFE_SUCCESS){
+            return(status);
+        }
+
+        pool->worker_count++;
+    }
+
+    return(CFE_SUCCESS);
+
+} /* End of OBJECT_Parse_Init */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  OBJECT_Parse_Dispatch                                              */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Queues the files that have appeared since the last cycle, as       */
+/*         far as free slots allow. Returns the number queued.                */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * *  * *  * * * * */
+uint32 OBJECT_Parse_Dispatch(OBJECT_Parse_Pool_t *pool){
+    OBJECT_Parse_Slot_t *slot;
+    os_fstat_t fileStat;
+    char fileLoc[100];
+    uint32 queued = 0;
+
+    while((pool->next_dispatch - pool->next_commit) < OBJECT_PARSE_SLOTS){
+
+        // Files are written in order, the first missing one ends the backlog
+        OBJECT_Parse_Path(fileLoc, sizeof(fileLoc), pool->next_dispatch);
+        if(OS_stat(fileLoc, &fileStat) != OS_SUCCESS){
+            break;
+        }
+
+        // Free, its previous file was committed before 'next_commit' moved on
+        slot = &pool->slots[pool->next_dispatch % OBJECT_PARSE_SLOTS];
+        slot->file_num = pool->next_dispatch;
+        slot->trace.arrival_us = OBJECT_Latency_Now();
+        slot->trace.parsed_us = 0;
+        slot->trace.inserted_us = 0;
+        OBJECT_EPOCH_STORE_RELEASE(&slot->state, OBJECT_PARSE_SLOT_QUEUED);
+
+        pool->next_dispatch++;
+        queued++;
+
+        OS_CountSemGive(pool->work_sem_id);
+    }
+
+    return(queued);
+
+} /* End of OBJECT_Parse_Dispatch */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  OBJECT_Parse_Commit                                                */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Inserts the parsed frames into the history in file order,          */
+/*         stopping at the first one still being parsed. Returns the          */
+/*         number committed.                                                  */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * *  * *  * * * * */
+uint32 OBJECT_Parse_Commit(OBJECT_Parse_Pool_t *pool){
+    OBJECT_Parse_Slot_t *slot;
+    uint32 committed = 0;
+
+    while(pool->next_commit != pool->next_dispatch){
+        slot = &pool->slots[pool->next_commit % OBJECT_PARSE_SLOTS];
+
+        if(OBJECT_EPOCH_LOAD_ACQUIRE(&slot->state) != OBJECT_PARSE_SLOT_DONE){
+            break;
+        }
+
+        OBJECT_TrackerData.IngestTrace = slot->trace;
+        OBJECT_Commit_Rovers(&slot->rovers);
+
+        OBJECT_EPOCH_STORE_RELEASE(&slot->state, OBJECT_PARSE_SLOT_FREE);
+        pool->next_commit++;
+        committed++;
+    }
+
+    return(committed);
+
+} /* End of OBJECT_Parse_Commit */
@@ -0,0 +1,93 @@
+/*******************************************************************************
+**
+**      GSC-18128-1, "Core Flight Executive Version 6.7"
+**
+**      Copyright (c) 2006-2019 United States Government as represented by
+**      the Administrator of the National Aeronautics and Space Administration.
+**      All Rights Reserved.
+**
+**      Licensed under the Apache License, Version 2.0 (the "License");
+**      you may not use this file except in compliance with the License.
+**      You may obtain a copy of the License at
+**
+**        http://www.apache.org/licenses/LICENSE-2.0
+**
+**      Unless required by applicable law or agreed to in writing, software
+**      distributed under the License is distributed on an "AS IS" BASIS,
+**      WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**      See the License for the specific language governing permissions and
+**      limitations under the License.
+**
+**
+** File: object_tracking_app_parse.h
+**
+** Purpose:
+**   Parse worker tasks for a backlog of 'Output_N' files.
+**
+** Notes:
+**   Files are parsed out of order by up to OBJECT_PARSE_WORKERS child tasks
+**   and committed to the history by the main task strictly in file order.
+**   'sync_fusion_injest' must be reentrant, each worker parses into its own
+**   slot.
+**
+*******************************************************************************/
+
+#ifndef _object_tracking_app_parse_h_
+#define _object_tracking_app_parse_h_
+
+#include "cfe.h"
+
+#include "object_tracking_app_msg.h"
+
+// Parse worker tasks for file ingest, 0 parses on the main task
+#define OBJECT_PARSE_WORKERS                  2
+#define OBJECT_PARSE_WORKERS_MAX              8
+
+// Frame buffers, the most files queued or parsed ahead of the next commit
+#define OBJECT_PARSE_SLOTS                    16
+
+#define OBJECT_PARSE_TASK_STACK               32768
+#define OBJECT_PARSE_TASK_PRIORITY            150
+
+// Slot states
+#define OBJECT_PARSE_SLOT_FREE                0
+#define OBJECT_PARSE_SLOT_QUEUED              1
+#define OBJECT_PARSE_SLOT_BUSY                2
+#define OBJECT_PARSE_SLOT_DONE                3
+
+typedef struct
+{
+    // Parsed frame and the file it came from
+    rover_array             rovers;
+    int                     file_num;
+
+    // Arrival and parse timestamps, carried to the samples
+    OBJECT_Latency_Trace_t  trace;
+
+    // OBJECT_PARSE_SLOT_*, handed between tasks with acquire/release
+    uint32                  state;
+} OBJECT_Parse_Slot_t;
+
+typedef struct
+{
+    // File 'n' is parsed into slot 'n % OBJECT_PARSE_SLOTS'
+    OBJECT_Parse_Slot_t     slots[OBJECT_PARSE_SLOTS];
+
+    // Guards 'next_claim', one semaphore count per queued slot
+    uint32                  mutex_id;
+    uint32                  work_sem_id;
+
+    uint32                  task_ids[OBJECT_PARSE_WORKERS_MAX];
+    uint32                  worker_count;
+
+    // Next file to queue, to hand to a worker and to commit
+    int                     next_dispatch;
+    int                     next_claim;
+    int                     next_commit;
+} OBJECT_Parse_Pool_t;
+
+int32  OBJECT_Parse_Init(OBJECT_Parse_Pool_t *pool, uint32 workers, int first_file);
+uint32 OBJECT_Parse_Dispatch(OBJECT_Parse_Pool_t *pool);
+uint32 OBJECT_Parse_Commit(OBJECT_Parse_Pool_t *pool);
+
+#endif /* _object_tracking_app_parse_h_ */
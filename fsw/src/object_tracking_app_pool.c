@@ -0,0 +1,135 @@
+/*******************************************************************************
+**
+**      GSC-18128-1, "Core Flight Executive Version 6.7"
+**
+**      Copyright (c) 2006-2019 United States Government as represented by
+**      the Administrator of the National Aeronautics and Space Administration.
+**      All Rights Reserved.
+**
+**      Licensed under the Apache License, Version 2.0 (the "License");
+**      you may not use this file except in compliance with the License.
+**      You may obtain a copy of the License at
+**
+**        http://www.apache.org/licenses/LICENSE-2.0
+**
+**      Unless required by applicable law or agreed to in writing, software
+**      distributed under the License is distributed on an "AS IS" BASIS,
+**      WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**      See the License for the specific language governing permissions and
+**      limitations under the License.
+**
+**
+** File: object_tracking_app_pool.c
+**
+** Purpose:
+**   Hands out and takes back history nodes from a static pool, so samples
+**   never live on the stack and evicted samples are reused. A pool is only
+**   used by the shard owning it.
+**
+*******************************************************************************/
+
+/*
+** Include Files:
+*/
+#include "object_tracking_app_pool.h"
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  OBJECT_Pool_Init                                                   */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Chains the 'headroom' nodes after the first 'size' ones into the   */
+/*         reserve and the first 'size' nodes into the free list              */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * *  * *  * * * * */
+void OBJECT_Pool_Init(OBJECT_Sample_Pool_t *pool, Object_Node_t *nodes, uint32 size, uint32 headroom){
+    uint32 itr;
+
+    memset(pool, 0, sizeof(*pool));
+    pool->nodes = nodes;
+    pool->headroom = headroom;
+
+    for(itr = 0; itr < size; itr++){
+        pool->nodes[itr].next_node = pool->free_list;
+        pool->free_list = &pool->nodes[itr];
+    }
+    pool->free_count = size;
+
+    for(; itr < size + headroom; itr++){
+        pool->nodes[itr].next_node = pool->reserve_list;
+        pool->reserve_list = &pool->nodes[itr];
+    }
+    pool->reserve_count = headroom;
+
+} /* End of OBJECT_Pool_Init */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  OBJECT_Pool_Alloc                                                  */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Takes a cleared node from the pool, NULL when it is empty          */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * *  * *  * * * * */
+Object_Node_t *OBJECT_Pool_Alloc(OBJECT_Sample_Pool_t *pool){
+    Object_Node_t *node = pool->free_list;
+
+    if(node == NULL){
+        return(NULL);
+    }
+
+    pool->free_list = node->next_node;
+    pool->free_count--;
+
+    memset(node, 0, sizeof(*node));
+
+    return(node);
+
+} /* End of OBJECT_Pool_Alloc */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  OBJECT_Pool_Alloc_Reserve                                          */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Takes a cleared headroom node, NULL when the headroom is used up.  */
+/*         Only for samples stored while evicted ones are held back.          */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * *  * *  * * * * */
+Object_Node_t *OBJECT_Pool_Alloc_Reserve(OBJECT_Sample_Pool_t *pool){
+    Object_Node_t *node = pool->reserve_list;
+
+    if(node == NULL){
+        return(NULL);
+    }
+
+    pool->reserve_list = node->next_node;
+    pool->reserve_count--;
+
+    memset(node, 0, sizeof(*node));
+
+    return(node);
+
+} /* End of OBJECT_Pool_Alloc_Reserve */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  OBJECT_Pool_Free                                                   */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Returns an unlinked node to the pool, topping up the headroom      */
+/*         first                                                              */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * *  * *  * * * * */
+void OBJECT_Pool_Free(OBJECT_Sample_Pool_t *pool, Object_Node_t *node){
+
+    node->previous_node = NULL;
+
+    if(pool->reserve_count < pool->headroom){
+        node->next_node = pool->reserve_list;
+        pool->reserve_list = node;
+        pool->reserve_count++;
+        return;
+    }
+
+    node->next_node = pool->free_list;
+    pool->free_list = node;
+    pool->free_count++;
+
+} /* End of OBJECT_Pool_Free */
@@ -0,0 +1,73 @@
+/*******************************************************************************
+**
+**      GSC-18128-1, "Core Flight Executive Version 6.7"
+**
+**      Copyright (c) 2006-2019 United States Government as represented by
+**      the Administrator of the National Aeronautics and Space Administration.
+**      All Rights Reserved.
+**
+**      Licensed under the Apache License, Version 2.0 (the "License");
+**      you may not use this file except in compliance with the License.
+**      You may obtain a copy of the License at
+**
+**        http://www.apache.org/licenses/LICENSE-2.0
+**
+**      Unless required by applicable law or agreed to in writing, software
+**      distributed under the License is distributed on an "AS IS" BASIS,
+**      WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**      See the License for the specific language governing permissions and
+**      limitations under the License.
+**
+**
+** File: object_tracking_app_pool.h
+**
+** Purpose:
+**   Fixed sample pools backing the object history nodes. Every shard owns
+**   one, carved from a single static node array.
+**
+*******************************************************************************/
+
+#ifndef _object_tracking_app_pool_h_
+#define _object_tracking_app_pool_h_
+
+#include "cfe.h"
+
+#include "object_tracking_app_msg.h"
+
+// Memory budget of the histories of all classes, split evenly between the shards
+#define OBJECT_SAMPLE_BUDGET_BYTES            (256 * 1024)
+#define OBJECT_SAMPLE_POOL_SIZE               (OBJECT_SAMPLE_BUDGET_BYTES / sizeof(Object_Node_t))
+
+// Extra nodes on top of the budget, only handed out while an open snapshot
+// holds evicted samples back, so new samples keep being stored meanwhile
+#define OBJECT_SAMPLE_HEADROOM_BYTES          (64 * 1024)
+#define OBJECT_SAMPLE_HEADROOM                (OBJECT_SAMPLE_HEADROOM_BYTES / sizeof(Object_Node_t))
+
+// Samples every class keeps when others of its shard evict, each shard's
+// share of the budget must cover them all
+#define OBJECT_CLASS_MIN_SAMPLES              8
+
+// Eviction priority of every class at startup
+#define OBJECT_CLASS_PRIORITY_DEFAULT         0
+
+typedef struct
+{
+    // Slice of the node array, budget nodes first, then the headroom
+    Object_Node_t   *nodes;
+    uint32          headroom;
+
+    // Unused nodes, chained through 'next_node'
+    Object_Node_t   *free_list;
+    uint32          free_count;
+
+    // Unused headroom nodes, refilled first when nodes come back
+    Object_Node_t   *reserve_list;
+    uint32          reserve_count;
+} OBJECT_Sample_Pool_t;
+
+void           OBJECT_Pool_Init(OBJECT_Sample_Pool_t *pool, Object_Node_t *nodes, uint32 size, uint32 headroom);
+Object_Node_t *OBJECT_Pool_Alloc(OBJECT_Sample_Pool_t *pool);
+Object_Node_t *OBJECT_Pool_Alloc_Reserve(OBJECT_Sample_Pool_t *pool);
+void           OBJECT_Pool_Free(OBJECT_Sample_Pool_t *pool, Object_Node_t *node);
+
+#endif /* _object_tracking_app_pool_h_ */
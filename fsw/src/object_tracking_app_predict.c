@@ -0,0 +1,103 @@
+/*******************************************************************************
+**
+**      GSC-18128-1, "Core Flight Executive Version 6.7"
+**
+**      Copyright (c) 2006-2019 United States Government as represented by
+**      the Administrator of the National Aeronautics and Space Administration.
+**      All Rights Reserved.
+**
+**      Licensed under the Apache License, Version 2.0 (the "License");
+**      you may not use this file except in compliance with the License.
+**      You may obtain a copy of the License at
+**
+**        http://www.apache.org/licenses/LICENSE-2.0
+**
+**      Unless required by applicable law or agreed to in writing, software
+**      distributed under the License is distributed on an "AS IS" BASIS,
+**      WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**      See the License for the specific language governing permissions and
+**      limitations under the License.
+**
+**
+** File: object_tracking_app_predict.c
+**
+** Purpose:
+**   Constant rate prediction of track range and bearing from the derived
+**   kinematics, with an uncertainty that grows with the horizon.
+**
+*******************************************************************************/
+
+/*
+** Include Files:
+*/
+#include <math.h>
+
+#include "object_tracking_app_predict.h"
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  OBJECT_Predict_Time                                                */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Converts a cFE time to seconds in the detection timestamp base     */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * *  * *  * * * * */
+double OBJECT_Predict_Time(CFE_TIME_SysTime_t time){
+
+    return(((double) time.Seconds - (double) OBJECT_PREDICT_EPOCH_OFFSET_SEC) +
+           ((double) CFE_TIME_Sub2MicroSecs(time.Subseconds) / 1000000.0));
+
+} /* End of OBJECT_Predict_Time */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  OBJECT_Predict_Track                                               */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Predicts a track's distance and orientation at time 'at'.          */
+/*         Without a motion estimate, or past the horizon limit, the last     */
+/*         observation is reported and 'valid' is 0.                          */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * *  * *  * * * * */
+void OBJECT_Predict_Track(const OBJECT_Kinematics_Table_t *table, const OBJECT_Compact_Data_t *compact,
+                          uint16 track_id, double at, OBJECT_Prediction_Data_t *prediction){
+    const OBJECT_Kinematics_Track_t *track;
+    double dt;
+    double value;
+
+    memset(prediction, 0, sizeof(*prediction));
+    prediction->track_id = track_id;
+
+    if((track_id == 0) || (track_id > OBJECT_DICT_MAX_TRACKS) || !table->tracks[track_id - 1].seen){
+        return;
+    }
+
+    track = &table->tracks[track_id - 1];
+    prediction->class_id = compact->tracks[track_id - 1].class_id;
+
+    dt = (at - (double) track->timeStamp_sec) - ((double) track->timeStamp_nanoSec / 1000000000.0);
+
+    prediction->horizon = (float) dt;
+    prediction->distance = (float) track->distance;
+    prediction->orientation = (float) track->orientation;
+    prediction->distance_sigma = (float) OBJECT_PREDICT_DISTANCE_SIGMA;
+    prediction->orientation_sigma = (float) OBJECT_PREDICT_ORIENTATION_SIGMA;
+
+    if(!track->result.valid || (fabs(dt) > OBJECT_PREDICT_MAX_HORIZON_SEC)){
+        return;
+    }
+
+    // Range can't go negative, orientation wraps to 0 - 360
+    value = track->distance + (track->result.range_rate * dt);
+    prediction->distance = (float) ((value > 0.0) ? value : 0.0);
+
+    value = fmod(track->orientation + (track->result.bearing_rate * dt), 360.0);
+    prediction->orientation = (float) ((value < 0.0) ? (value + 360.0) : value);
+
+    // Measurement noise plus the rate spread carried over the horizon
+    prediction->distance_sigma = (float) sqrt((OBJECT_PREDICT_DISTANCE_SIGMA * OBJECT_PREDICT_DISTANCE_SIGMA) +
+                                              (track->range_rate_var * dt * dt));
+    prediction->orientation_sigma = (float) sqrt((OBJECT_PREDICT_ORIENTATION_SIGMA * OBJECT_PREDICT_ORIENTATION_SIGMA) +
+                                                 (track->bearing_rate_var * dt * dt));
+
+    prediction->valid = 1;
+
+} /* End of OBJECT_Predict_Track */
@@ -0,0 +1,54 @@
+/*******************************************************************************
+**
+**      GSC-18128-1, "Core Flight Executive Version 6.7"
+**
+**      Copyright (c) 2006-2019 United States Government as represented by
+**      the Administrator of the National Aeronautics and Space Administration.
+**      All Rights Reserved.
+**
+**      Licensed under the Apache License, Version 2.0 (the "License");
+**      you may not use this file except in compliance with the License.
+**      You may obtain a copy of the License at
+**
+**        http://www.apache.org/licenses/LICENSE-2.0
+**
+**      Unless required by applicable law or agreed to in writing, software
+**      distributed under the License is distributed on an "AS IS" BASIS,
+**      WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**      See the License for the specific language governing permissions and
+**      limitations under the License.
+**
+**
+** File: object_tracking_app_predict.h
+**
+** Purpose:
+**   Extrapolates track states to a requested time to make up for the
+**   camera, detector and transport latency.
+**
+*******************************************************************************/
+
+#ifndef _object_tracking_app_predict_h_
+#define _object_tracking_app_predict_h_
+
+#include "cfe.h"
+
+#include "object_tracking_app_msg.h"
+#include "object_tracking_app_compact.h"
+#include "object_tracking_app_kinematics.h"
+
+// Seconds to add to a detection timestamp to get cFE seconds,
+// 0 when the detector and cFE time share an epoch
+#define OBJECT_PREDICT_EPOCH_OFFSET_SEC       0
+
+// Longest extrapolation past a track's last observation
+#define OBJECT_PREDICT_MAX_HORIZON_SEC        2.0
+
+// One sigma measurement noise of distance (m) and orientation (deg)
+#define OBJECT_PREDICT_DISTANCE_SIGMA         0.05
+#define OBJECT_PREDICT_ORIENTATION_SIGMA      1.0
+
+double OBJECT_Predict_Time(CFE_TIME_SysTime_t time);
+void   OBJECT_Predict_Track(const OBJECT_Kinematics_Table_t *table, const OBJECT_Compact_Data_t *compact,
+                            uint16 track_id, double at, OBJECT_Prediction_Data_t *prediction);
+
+#endif /* _object_tracking_app_predict_h_ */
@@ -0,0 +1,184 @@
+/*******************************************************************************
+**
+**      GSC-18128-1, "Core Flight Executive Version 6.7"
+**
+**      Copyright (c) 2006-2019 United States Government as represented by
+**      the Administrator of the National Aeronautics and Space Administration.
+**      All Rights Reserved.
+**
+**      Licensed under the Apache License, Version 2.0 (the "License");
+**      you may not use this file except in compliance with the License.
+**      You may obtain a copy of the License at
+**
+**        http://www.apache.org/licenses/LICENSE-2.0
+**
+**      Unless required by applicable law or agreed to in writing, software
+**      distributed under the License is distributed on an "AS IS" BASIS,
+**      WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**      See the License for the specific language governing permissions and
+**      limitations under the License.
+**
+**
+** File: object_tracking_app_retire.c
+**
+** Purpose:
+**   Deletes or archives processed 'Output_N' files in batches on a low
+**   priority child task, so the ingest directory stays small and the main
+**   task never pays for the directory operations.
+**
+*******************************************************************************/
+
+/*
+** Include Files:
+*/
+#include <errno.h>
+#include <stdio.h>
+#include <sys/stat.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "object_tracking_app_events.h"
+#include "object_tracking_app.h"
+
+extern OBJECT_TrackerData_t OBJECT_TrackerData;
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  OBJECT_Retire_File                                                 */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Deletes or archives one processed file. Returns false when it      */
+/*         is too young to retire yet.                                        */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * *  * *  * * * * */
+static bool OBJECT_Retire_File(OBJECT_Retire_t *retire, int file_num){
+    struct stat fileStat;
+    struct tm   fileDay;
+    time_t      modified;
+    char fileLoc[100];
+    char archiveLoc[160];
+    int  status;
+
+    snprintf(fileLoc, sizeof(fileLoc), "%sOutput_%d", ROS2_FILE_LOC, file_num);
+
+    // Never written, or already gone
+    if(stat(fileLoc, &fileStat) != 0){
+        return(true);
+    }
+
+    if((OBJECT_RETIRE_KEEP_AGE_SEC > 0) && ((time(NULL) - fileStat.st_mtime) < OBJECT_RETIRE_KEEP_AGE_SEC)){
+        return(false);
+    }
+
+    if(OBJECT_RETIRE_MODE == OBJECT_RETIRE_DELETE){
+        status = unlink(fileLoc);
+    } else {
+        modified = fileStat.st_mtime;
+        gmtime_r(&modified, &fileDay);
+
+        // Creates the day's directory on its first file
+        strftime(archiveLoc, sizeof(archiveLoc), OBJECT_RETIRE_ARCHIVE_DIR "%Y%m%d", &fileDay);
+        mkdir(OBJECT_RETIRE_ARCHIVE_DIR, 0770);
+        mkdir(archiveLoc, 0770);
+
+        snprintf(archiveLoc + strlen(archiveLoc), sizeof(archiveLoc) - strlen(archiveLoc), "/Output_%d", file_num);
+        status = rename(fileLoc, archiveLoc);
+    }
+
+    if(status != 0){
+        // One event per failing file would flood the ground, report the first
+        if(retire->error_count++ == 0){
+            CFE_EVS_SendEvent(OBJECT_RETIRE_ERR_EID,
+                              CFE_EVS_EventType_ERROR,
+                              "Could not retire %s, errno = %d",
+                              fileLoc,
+                              errno);
+        }
+        return(true);
+    }
+
+    retire->retired_count++;
+
+    // Archived files still use the disk, they only leave the ingest directory
+    if(OBJECT_RETIRE_MODE == OBJECT_RETIRE_DELETE){
+        retire->reclaimed_bytes += (uint64) fileStat.st_size;
+    }
+
+    return(true);
+
+} /* End of OBJECT_Retire_File */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  OBJECT_Retire_Task                                                 */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Retirement task entry point. Every OBJECT_RETIRE_PERIOD_MS         */
+/*         retires up to OBJECT_RETIRE_BATCH processed files, oldest first,   */
+/*         keeping the newest OBJECT_RETIRE_KEEP_COUNT in place.              */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * *  * *  * * * * */
+static void OBJECT_Retire_Task(void){
+    OBJECT_Retire_t *retire = &OBJECT_TrackerData.Retire;
+    uint32 batch;
+    int    end;
+
+    if(CFE_ES_RegisterChildTask() != CFE_SUCCESS){
+        return;
+    }
+
+    while(OS_TaskDelay(OBJECT_RETIRE_PERIOD_MS) == OS_SUCCESS){
+        end = OBJECT_EPOCH_LOAD_ACQUIRE(&retire->committed_end) - OBJECT_RETIRE_KEEP_COUNT;
+
+        for(batch = 0; (batch < OBJECT_RETIRE_BATCH) && (retire->next_retire < end); batch++){
+            // Files age in order, the first young one ends the batch
+            if(!OBJECT_Retire_File(retire, retire->next_retire)){
+                break;
+            }
+            retire->next_retire++;
+        }
+    }
+
+    CFE_ES_ExitChildTask();
+
+} /* End of OBJECT_Retire_Task */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  OBJECT_Retire_Init                                                 */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Starts the retirement task unless retirement is off.               */
+/*         'first_file' is the first file number ingest will process.         */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * *  * *  * * * * */
+int32 OBJECT_Retire_Init(OBJECT_Retire_t *retire, int first_file){
+
+    memset(retire, 0, sizeof(*retire));
+    retire->committed_end = first_file;
+    retire->next_retire = first_file;
+
+    if(OBJECT_RETIRE_MODE == OBJECT_RETIRE_OFF){
+        return(CFE_SUCCESS);
+    }
+
+    return(CFE_ES_CreateChildTask(&retire->task_id,
+                                  "OBJECT_RETIRE",
+                                  OBJECT_Retire_Task,
+                                  NULL,
+                                  OBJECT_RETIRE_TASK_STACK,
+                                  OBJECT_RETIRE_TASK_PRIORITY,
+                                  0));
+
+} /* End of OBJECT_Retire_Init */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  OBJECT_Retire_Committed                                            */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Called by ingest once every file before 'committed_end' is in      */
+/*         the history                                                        */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * *  * *  * * * * */
+void OBJECT_Retire_Committed(OBJECT_Retire_t *retire, int committed_end){
+
+    OBJECT_EPOCH_STORE_RELEASE(&retire->committed_end, committed_end);
+
+} /* End of OBJECT_Retire_Committed */
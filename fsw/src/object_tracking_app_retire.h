@@ -0,0 +1,75 @@
+/*******************************************************************************
+**
+**      GSC-18128-1, "Core Flight Executive Version 6.7"
+**
+**      Copyright (c) 2006-2019 United States Government as represented by
+**      the Administrator of the National Aeronautics and Space Administration.
+**      All Rights Reserved.
+**
+**      Licensed under the Apache License, Version 2.0 (the "License");
+**      you may not use this file except in compliance with the License.
+**      You may obtain a copy of the License at
+**
+**        http://www.apache.org/licenses/LICENSE-2.0
+**
+**      Unless required by applicable law or agreed to in writing, software
+**      distributed under the License is distributed on an "AS IS" BASIS,
+**      WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**      See the License for the specific language governing permissions and
+**      limitations under the License.
+**
+**
+** File: object_tracking_app_retire.h
+**
+** Purpose:
+**   Retirement of processed 'Output_N' files on a child task.
+**
+*******************************************************************************/
+
+#ifndef _object_tracking_app_retire_h_
+#define _object_tracking_app_retire_h_
+
+#include "cfe.h"
+
+// What happens to a processed file
+#define OBJECT_RETIRE_OFF                     0 /* Left in place */
+#define OBJECT_RETIRE_DELETE                  1 /* Removed */
+#define OBJECT_RETIRE_ARCHIVE                 2 /* Moved to OBJECT_RETIRE_ARCHIVE_DIR/YYYYMMDD/ */
+#define OBJECT_RETIRE_MODE                    OBJECT_RETIRE_ARCHIVE
+
+// Archive root, one subdirectory per UTC day of the file's modification time
+#define OBJECT_RETIRE_ARCHIVE_DIR             "/root/img_data/archive/"
+
+// Newest processed files always kept in place
+#define OBJECT_RETIRE_KEEP_COUNT              64
+
+// Processed files younger than this are kept in place, 0 disables the age check
+#define OBJECT_RETIRE_KEEP_AGE_SEC            0
+
+// Files retired per wakeup and the time between wakeups
+#define OBJECT_RETIRE_BATCH                   256
+#define OBJECT_RETIRE_PERIOD_MS               1000
+
+#define OBJECT_RETIRE_TASK_STACK              16384
+#define OBJECT_RETIRE_TASK_PRIORITY           200
+
+typedef struct
+{
+    // First file not yet committed to the history, set by the main task
+    int                 committed_end;
+
+    // Next file to retire, only used by the retirement task
+    int                 next_retire;
+
+    uint32              task_id;
+
+    // Written by the retirement task, reported in housekeeping
+    uint32              retired_count;
+    uint32              error_count;
+    uint64              reclaimed_bytes;
+} OBJECT_Retire_t;
+
+int32 OBJECT_Retire_Init(OBJECT_Retire_t *retire, int first_file);
+void  OBJECT_Retire_Committed(OBJECT_Retire_t *retire, int committed_end);
+
+#endif /* _object_tracking_app_retire_h_ */
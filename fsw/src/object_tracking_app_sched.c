@@ -0,0 +1,161 @@
+/*******************************************************************************
+**
+**      GSC-18128-1, "Core Flight Executive Version 6.7"
+**
+**      Copyright (c) 2006-2019 United States Government as represented by
+**      the Administrator of the National Aeronautics and Space Administration.
+**      All Rights Reserved.
+**
+**      Licensed under the Apache License, Version 2.0 (the "License");
+**      you may not use this file except in compliance with the License.
+**      You may obtain a copy of the License at
+**
+**        http://www.apache.org/licenses/LICENSE-2.0
+**
+**      Unless required by applicable law or agreed to in writing, software
+**      distributed under the License is distributed on an "AS IS" BASIS,
+**      WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**      See the License for the specific language governing permissions and
+**      limitations under the License.
+**
+**
+** File: object_tracking_app_sched.c
+**
+** Purpose:
+**   Decides how many pending samples each class may publish in a cycle,
+**   so that many enabled classes degrade gracefully instead of flooding
+**   the bus and the downlink.
+**
+** Notes:
+**   Classes are served by descending priority, round-robin among equal
+**   priorities. A class at OBJECT_SCHED_PRIORITY_ALWAYS or above is served
+**   in full every cycle and only charged to the budget. Other classes get
+**   what their token bucket and the rest of the budget allow. A class that
+**   gets nothing keeps its samples for the next cycle (deferred); one that
+**   gets less than it has publishes its newest samples and drops the older
+**   ones (decimated).
+**
+*******************************************************************************/
+
+/*
+** Include Files:
+*/
+#include "object_tracking_app_sched.h"
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  OBJECT_Sched_Init                                                  */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Unlimited rates at the default priority and the default budget     */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * *  * *  * * * * */
+void OBJECT_Sched_Init(OBJECT_Sched_t *sched){
+    int itr;
+
+    memset(sched, 0, sizeof(*sched));
+    sched->max_msgs = OBJECT_SCHED_MSGS_PER_CYCLE;
+    sched->max_bytes = OBJECT_SCHED_BYTES_PER_CYCLE;
+
+    for(itr = 0; itr < MAX_OBJECT_TRACKING; itr++){
+        sched->classes[itr].priority = OBJECT_SCHED_PRIORITY_DEFAULT;
+    }
+
+} /* End of OBJECT_Sched_Init */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  OBJECT_Sched_Begin                                                 */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Starts a publish cycle: refills the token buckets and the budget   */
+/*         and fills 'order' with the class ids in the order to serve them.   */
+/*         'samples_per_msg' is how many samples the format packs per message.*/
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * *  * *  * * * * */
+void OBJECT_Sched_Begin(OBJECT_Sched_t *sched, uint64 now, uint16 samples_per_msg, uint8 *order){
+    OBJECT_Sched_Class_t *class;
+    double elapsed = (sched->last_us != 0) ? ((double) (now - sched->last_us) / 1000000.0) : 0.0;
+    double burst;
+    uint8  key;
+    int    itr;
+    int    pos;
+
+    sched->last_us = now;
+    sched->samples_left = (uint32) sched->max_msgs * samples_per_msg;
+    sched->bytes_left = sched->max_bytes;
+
+    for(itr = 0; itr < MAX_OBJECT_TRACKING; itr++){
+        class = &sched->classes[itr];
+        if(class->max_rate_mhz == 0){
+            continue;
+        }
+
+        // Always room for one sample, even below 1 Hz
+        burst = (class->max_rate_mhz / 1000.0) * OBJECT_SCHED_BURST_SEC;
+        if(burst < 1.0){
+            burst = 1.0;
+        }
+
+        class->tokens += (class->max_rate_mhz / 1000.0) * elapsed;
+        if(class->tokens > burst){
+            class->tokens = burst;
+        }
+    }
+
+    // Rotated start, then a stable insertion sort by descending priority
+    sched->round_robin++;
+    for(itr = 0; itr < MAX_OBJECT_TRACKING; itr++){
+        key = (uint8) ((itr + sched->round_robin) % MAX_OBJECT_TRACKING);
+
+        for(pos = itr; (pos > 0) && (sched->classes[order[pos - 1]].priority < sched->classes[key].priority); pos--){
+            order[pos] = order[pos - 1];
+        }
+        order[pos] = key;
+    }
+
+} /* End of OBJECT_Sched_Begin */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  OBJECT_Sched_Grant                                                 */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Number of its 'pending' samples a class may publish now, each      */
+/*         'sample_bytes' long on the wire. Charges them to the budget.       */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * *  * *  * * * * */
+uint32 OBJECT_Sched_Grant(OBJECT_Sched_t *sched, uint8 class_id, uint32 pending, uint32 sample_bytes){
+    OBJECT_Sched_Class_t *class = &sched->classes[class_id];
+    uint32 allowed = pending;
+
+    if(pending == 0){
+        return(0);
+    }
+
+    if((class->max_rate_mhz != 0) && (allowed > (uint32) class->tokens)){
+        allowed = (uint32) class->tokens;
+    }
+
+    if(class->priority < OBJECT_SCHED_PRIORITY_ALWAYS){
+        if(allowed > sched->samples_left){
+            allowed = sched->samples_left;
+        }
+        if((sample_bytes != 0) && (allowed > (sched->bytes_left / sample_bytes))){
+            allowed = sched->bytes_left / sample_bytes;
+        }
+    }
+
+    if(allowed == 0){
+        sched->deferred_count++;
+        return(0);
+    }
+
+    if(class->max_rate_mhz != 0){
+        class->tokens -= allowed;
+    }
+
+    sched->samples_left = (allowed < sched->samples_left) ? (sched->samples_left - allowed) : 0;
+    sched->bytes_left = ((allowed * sample_bytes) < sched->bytes_left) ? (sched->bytes_left - (allowed * sample_bytes)) : 0;
+    sched->dropped_count += pending - allowed;
+
+    return(allowed);
+
+} /* End of OBJECT_Sched_Grant */
@@ -0,0 +1,80 @@
+/*******************************************************************************
+**
+**      GSC-18128-1, "Core Flight Executive Version 6.7"
+**
+**      Copyright (c) 2006-2019 United States Government as represented by
+**      the Administrator of the National Aeronautics and Space Administration.
+**      All Rights Reserved.
+**
+**      Licensed under the Apache License, Version 2.0 (the "License");
+**      you may not use this file except in compliance with the License.
+**      You may obtain a copy of the License at
+**
+**        http://www.apache.org/licenses/LICENSE-2.0
+**
+**      Unless required by applicable law or agreed to in writing, software
+**      distributed under the License is distributed on an "AS IS" BASIS,
+**      WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**      See the License for the specific language governing permissions and
+**      limitations under the License.
+**
+**
+** File: object_tracking_app_sched.h
+**
+** Purpose:
+**   Output scheduler for essentials telemetry: per-class priorities, rate
+**   limits and a per-cycle message and byte budget.
+**
+*******************************************************************************/
+
+#ifndef _object_tracking_app_sched_h_
+#define _object_tracking_app_sched_h_
+
+#include "cfe.h"
+
+#include "object_tracking_app_msg.h"
+
+// Budget of every cycle at startup
+#define OBJECT_SCHED_MSGS_PER_CYCLE           128
+#define OBJECT_SCHED_BYTES_PER_CYCLE          (32 * 1024)
+
+// Publish priority at startup, and the priority from which a class goes every cycle
+#define OBJECT_SCHED_PRIORITY_DEFAULT         0
+#define OBJECT_SCHED_PRIORITY_ALWAYS          200
+
+// Seconds of samples a rate limited class may save up
+#define OBJECT_SCHED_BURST_SEC                1.0
+
+typedef struct
+{
+    uint8       priority;
+    uint32      max_rate_mhz;
+
+    // Token bucket of a rate limited class, in samples
+    double      tokens;
+} OBJECT_Sched_Class_t;
+
+typedef struct
+{
+    OBJECT_Sched_Class_t classes[MAX_OBJECT_TRACKING];
+
+    uint16      max_msgs;
+    uint32      max_bytes;
+
+    // What is left of this cycle's budget, in samples and bytes
+    uint32      samples_left;
+    uint32      bytes_left;
+
+    // Rotates the order of classes sharing a priority
+    uint32      round_robin;
+    uint64      last_us;
+
+    uint32      deferred_count;
+    uint32      dropped_count;
+} OBJECT_Sched_t;
+
+void   OBJECT_Sched_Init(OBJECT_Sched_t *sched);
+void   OBJECT_Sched_Begin(OBJECT_Sched_t *sched, uint64 now, uint16 samples_per_msg, uint8 *order);
+uint32 OBJECT_Sched_Grant(OBJECT_Sched_t *sched, uint8 class_id, uint32 pending, uint32 sample_bytes);
+
+#endif /* _object_tracking_app_sched_h_ */
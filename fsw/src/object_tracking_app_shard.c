@@ -0,0 +1,341 @@
+/*******************************************************************************
+**
+**      GSC-18128-1, "Core Flight Executive Version 6.7"
+**
+**      Copyright (c) 2006-2019 United States Government as represented by
+**      the Administrator of the National Aeronautics and Space Administration.
+**      All Rights Reserved.
+**
+**      Licensed under the Apache License, Version 2.0 (the "License");
+**      you may not use this file except in compliance with the License.
+**      You may obtain a copy of the License at
+**
+**        http://www.apache.org/licenses/LICENSE-2.0
+**
+**      Unless required by applicable law or agreed to in writing, software
+**      distributed under the License is distributed on an "AS IS" BASIS,
+**      WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**      See the License for the specific language governing permissions and
+**      limitations under the License.
+**
+**
+** File: object_tracking_app_shard.c
+**
+** Purpose:
+**   Runs the tracking of each set of classes on its own child task, fed
+**   through a detection queue per shard.
+**
+** Notes:
+**   The main task parses and fuses a frame, then copies every detection
+**   to the queue of its class's shard and wakes the shards that got any.
+**   It only waits for a shard when that shard's queue is full, and once
+**   per cycle for all of them, when each shard ages its tracks and
+**   prepares its classes' unpublished samples. Publication and command
+**   handling run after that barrier, while every shard is idle.
+**
+*******************************************************************************/
+
+/*
+** Include Files:
+*/
+#include "object_tracking_app.h"
+
+extern OBJECT_TrackerData_t OBJECT_TrackerData;
+
+// The full queue handshake orders each side's store before its load of the
+// other side's, which acquire/release alone doesn't
+#define OBJECT_SHARD_LOAD(ptr)                __atomic_load_n((ptr), __ATOMIC_SEQ_CST)
+#define OBJECT_SHARD_STORE(ptr, val)          __atomic_store_n((ptr), (val), __ATOMIC_SEQ_CST)
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  OBJECT_Shard_Drain                                                 */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Commits the queued detections a frame at a time and frees their    */
+/*         queue entries, waking the main task if it waits for space          */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * *  * *  * * * * */
+static void OBJECT_Shard_Drain(OBJECT_Shard_t *shard){
+    const OBJECT_Shard_Entry_t *batch[OBJECT_SHARD_QUEUE_DEPTH];
+    uint32 tail = OBJECT_EPOCH_LOAD_ACQUIRE(&shard->tail);
+    uint32 head = shard->head;
+    uint32 frame;
+    int    count;
+
+    while(head != tail){
+        frame = shard->queue[head & OBJECT_SHARD_QUEUE_MASK].frame;
+
+        count = 0;
+        while((head != tail) && (shard->queue[head & OBJECT_SHARD_QUEUE_MASK].frame == frame)){
+            batch[count++] = &shard->queue[head & OBJECT_SHARD_QUEUE_MASK];
+            head++;
+        }
+
+        OBJECT_Commit_Detections(shard, batch, count);
+
+        OBJECT_SHARD_STORE(&shard->head, head);
+        if(__atomic_exchange_n(&shard->producer_waiting, 0, __ATOMIC_SEQ_CST) != 0){
+            OS_BinSemGive(shard->space_sem_id);
+        }
+    }
+
+} /* End of OBJECT_Shard_Drain */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  OBJECT_Shard_End_Cycle                                             */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Ages the shard's tracks and prepares its classes' output           */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * *  * *  * * * * */
+static void OBJECT_Shard_End_Cycle(OBJECT_Shard_t *shard){
+
+    OBJECT_Age_Tracks(shard);
+    OBJECT_Prepare_Publish(shard);
+
+} /* End of OBJECT_Shard_End_Cycle */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  OBJECT_Shard_Task                                                  */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Shard task entry point. Drains its queue every time it is woken    */
+/*         and ends the cycle when the main task started a new one.           */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * *  * *  * * * * */
+static void OBJECT_Shard_Task(void){
+    OBJECT_Shard_Pool_t *pool = &OBJECT_TrackerData.Shards;
+    OBJECT_Shard_t *shard;
+    uint32 cycle;
+
+    if(CFE_ES_RegisterChildTask() != CFE_SUCCESS){
+        return;
+    }
+
+    OS_MutSemTake(pool->mutex_id);
+    shard = &pool->shards[pool->started++];
+    OS_MutSemGive(pool->mutex_id);
+
+    while(OS_BinSemTake(shard->work_sem_id) == OS_SUCCESS){
+        // Every frame of the cycle was queued before the cycle started
+        cycle = OBJECT_EPOCH_LOAD_ACQUIRE(&pool->cycle);
+
+        OBJECT_Shard_Drain(shard);
+
+        if(cycle != shard->cycle){
+            shard->cycle = cycle;
+            OBJECT_Shard_End_Cycle(shard);
+
+            OS_CountSemGive(pool->done_sem_id);
+        }
+    }
+
+    CFE_ES_ExitChildTask();
+
+} /* End of OBJECT_Shard_Task */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  OBJECT_Shard_Init                                                  */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Splits the sample nodes between the shards, creates their          */
+/*         semaphores and epoch domains and starts the shard tasks            */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * *  * *  * * * * */
+int32 OBJECT_Shard_Init(OBJECT_Shard_Pool_t *pool, Object_Node_t *nodes){
+    OBJECT_Shard_t *shard;
+    char   name[OS_MAX_API_NAME];
+    uint32 size = OBJECT_SAMPLE_POOL_SIZE / OBJECT_SHARD_PARTITIONS;
+    uint32 headroom = OBJECT_SAMPLE_HEADROOM / OBJECT_SHARD_PARTITIONS;
+    int32  status;
+    uint32 itr;
+
+    memset(pool, 0, sizeof(*pool));
+    pool->shard_count = OBJECT_SHARD_PARTITIONS;
+
+    status = OS_MutSemCreate(&pool->mutex_id, "OBJECT_SHARD_MUT", 0);
+    if(status != OS_SUCCESS){
+        return(status);
+    }
+
+    status = OS_CountSemCreate(&pool->done_sem_id, "OBJECT_SHARD_DONE", 0, 0);
+    if(status != OS_SUCCESS){
+        return(status);
+    }
+
+    for(itr = 0; itr < pool->shard_count; itr++){
+        shard = &pool->shards[itr];
+        shard->index = itr;
+
+        OBJECT_Pool_Init(&shard->pool, &nodes[itr * (size + headroom)], size, headroom);
+
+        snprintf(name, sizeof(name), "OBJECT_EPOCH%lu", (unsigned long) itr);
+        status = OBJECT_Epoch_Init(&shard->epoch, name);
+        if(status != OS_SUCCESS){
+            return(status);
+        }
+
+        snprintf(name, sizeof(name), "OBJECT_SHARD_SEM%lu", (unsigned long) itr);
+        status = OS_BinSemCreate(&shard->work_sem_id, name, 0, 0);
+        if(status != OS_SUCCESS){
+            return(status);
+        }
+
+        snprintf(name, sizeof(name), "OBJECT_SHARD_SPC%lu", (unsigned long) itr);
+        status = OS_BinSemCreate(&shard->space_sem_id, name, 0, 0);
+        if(status != OS_SUCCESS){
+            return(status);
+        }
+    }
+
+    for(itr = 0; itr < OBJECT_SHARD_COUNT; itr++){
+        snprintf(name, sizeof(name), "OBJECT_SHARD_%lu", (unsigned long) itr);
+
+        status = CFE_ES_CreateChildTask(&pool->shards[itr].task_id,
+                                        name,
+                                        OBJECT_Shard_Task,
+                                        NULL,
+                                        OBJECT_SHARD_TASK_STACK,
+                                        OBJECT_SHARD_TASK_PRIORITY,
+                                        0);
+        if(status != CFE_SUCCESS){
+            return(status);
+        }
+
+        pool->task_count++;
+    }
+
+    return(CFE_SUCCESS);
+
+} /* End of OBJECT_Shard_Init */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  OBJECT_Shard_Wait_Space                                            */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Returns once a full shard queue has room again. Without shard      */
+/*         tasks the queue is drained on the spot.                            */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * *  * *  * * * * */
+static void OBJECT_Shard_Wait_Space(OBJECT_Shard_Pool_t *pool, OBJECT_Shard_t *shard){
+
+    if(pool->task_count == 0){
+        OBJECT_Shard_Drain(shard);
+        return;
+    }
+
+    OS_BinSemGive(shard->work_sem_id);
+
+    // Rechecked after raising the flag, the shard may have made room in between
+    while((shard->tail - OBJECT_SHARD_LOAD(&shard->head)) == OBJECT_SHARD_QUEUE_DEPTH){
+        OBJECT_SHARD_STORE(&shard->producer_waiting, 1);
+        if((shard->tail - OBJECT_SHARD_LOAD(&shard->head)) == OBJECT_SHARD_QUEUE_DEPTH){
+            OS_BinSemTake(shard->space_sem_id);
+        }
+        OBJECT_SHARD_STORE(&shard->producer_waiting, 0);
+    }
+
+} /* End of OBJECT_Shard_Wait_Space */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  OBJECT_Shard_Route                                                 */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Queues every detection of a frame on the shard owning its class    */
+/*         and wakes the shards that got any                                  */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * *  * *  * * * * */
+void OBJECT_Shard_Route(OBJECT_Shard_Pool_t *pool, const rover_array *rovers,
+                        const OBJECT_Latency_Trace_t *trace){
+    OBJECT_Shard_t *shard;
+    OBJECT_Shard_Entry_t *entry;
+    uint32 tails[OBJECT_SHARD_PARTITIONS];
+    bool   routed[OBJECT_SHARD_PARTITIONS];
+    uint32 index;
+    int    itr;
+
+    pool->frame++;
+
+    for(index = 0; index < pool->shard_count; index++){
+        tails[index] = pool->shards[index].tail;
+        routed[index] = false;
+    }
+
+    for(itr = 0; itr < rovers->arrayLen; itr++){
+        index = rovers->rovers_array[itr].class_id % pool->shard_count;
+        shard = &pool->shards[index];
+
+        // Hands over what is queued so far, the shard frees the oldest entries
+        if((tails[index] - OBJECT_SHARD_LOAD(&shard->head)) == OBJECT_SHARD_QUEUE_DEPTH){
+            OBJECT_EPOCH_STORE_RELEASE(&shard->tail, tails[index]);
+            OBJECT_Shard_Wait_Space(pool, shard);
+        }
+
+        entry = &shard->queue[tails[index] & OBJECT_SHARD_QUEUE_MASK];
+        entry->state = rovers->rovers_array[itr];
+        entry->trace = *trace;
+        entry->frame = pool->frame;
+
+        tails[index]++;
+        routed[index] = true;
+    }
+
+    for(index = 0; index < pool->shard_count; index++){
+        if(!routed[index]){
+            continue;
+        }
+
+        shard = &pool->shards[index];
+        OBJECT_EPOCH_STORE_RELEASE(&shard->tail, tails[index]);
+
+        if(pool->task_count > 0){
+            OS_BinSemGive(shard->work_sem_id);
+        } else {
+            OBJECT_Shard_Drain(shard);
+        }
+    }
+
+} /* End of OBJECT_Shard_Route */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  OBJECT_Shard_Cycle                                                 */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Ends the cycle on every shard and returns once all are idle with   */
+/*         their queues drained and their outputs prepared                    */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * *  * *  * * * * */
+void OBJECT_Shard_Cycle(OBJECT_Shard_Pool_t *pool){
+    uint32 itr;
+
+    if(pool->task_count == 0){
+        OBJECT_Shard_Drain(&pool->shards[0]);
+        OBJECT_Shard_End_Cycle(&pool->shards[0]);
+        return;
+    }
+
+    // The semaphores order the shards' work before the main task goes on
+    OBJECT_EPOCH_STORE_RELEASE(&pool->cycle, pool->cycle + 1);
+
+    for(itr = 0; itr < pool->task_count; itr++){
+        OS_BinSemGive(pool->shards[itr].work_sem_id);
+    }
+
+    for(itr = 0; itr < pool->task_count; itr++){
+        OS_CountSemTake(pool->done_sem_id);
+    }
+
+} /* End of OBJECT_Shard_Cycle */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  OBJECT_Shard_Of_Class                                              */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Shard owning a class's histories and tracks                        */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * *  * *  * * * * */
+OBJECT_Shard_t *OBJECT_Shard_Of_Class(OBJECT_Shard_Pool_t *pool, uint8 class_id){
+
+    return(&pool->shards[class_id % pool->shard_count]);
+
+} /* End of OBJECT_Shard_Of_Class */
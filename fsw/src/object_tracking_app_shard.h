@@ -0,0 +1,179 @@
+/*******************************************************************************
+**
+**      GSC-18128-1, "Core Flight Executive Version 6.7"
+**
+**      Copyright (c) 2006-2019 United States Government as represented by
+**      the Administrator of the National Aeronautics and Space Administration.
+**      All Rights Reserved.
+**
+**      Licensed under the Apache License, Version 2.0 (the "License");
+**      you may not use this file except in compliance with the License.
+**      You may obtain a copy of the License at
+**
+**        http://www.apache.org/licenses/LICENSE-2.0
+**
+**      Unless required by applicable law or agreed to in writing, software
+**      distributed under the License is distributed on an "AS IS" BASIS,
+**      WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**      See the License for the specific language governing permissions and
+**      limitations under the License.
+**
+**
+** File: object_tracking_app_shard.h
+**
+** Purpose:
+**   Shard tasks that track the classes they own: association, kinematics,
+**   statistics, history storage, track aging and publication preparation.
+**
+** Notes:
+**   Class 'c' belongs to shard 'c % OBJECT_SHARD_PARTITIONS'. A shard owns
+**   its classes' histories, its own sample pool and epoch domain, one
+**   dictionary partition and one lifecycle wheel, so shards never share a
+**   lock. The main task only routes detections to the shard queues, waits
+**   for every shard once per cycle, and merges the shard outputs into
+**   publication while the shards are idle.
+**
+*******************************************************************************/
+
+#ifndef _object_tracking_app_shard_h_
+#define _object_tracking_app_shard_h_
+
+#include "cfe.h"
+
+#include "object_tracking_app_msg.h"
+#include "object_tracking_app_compact.h"
+#include "object_tracking_app_pool.h"
+#include "object_tracking_app_epoch.h"
+
+// Shard tasks, 0 runs the single shard on the main task
+#define OBJECT_SHARD_COUNT                    2
+#define OBJECT_SHARD_COUNT_MAX                OBJECT_DICT_PARTITIONS_MAX
+
+// Shard contexts, there is always one even without shard tasks
+#define OBJECT_SHARD_PARTITIONS               ((OBJECT_SHARD_COUNT > 0) ? OBJECT_SHARD_COUNT : 1)
+
+#if OBJECT_SHARD_COUNT > OBJECT_SHARD_COUNT_MAX
+#error "OBJECT_SHARD_COUNT exceeds the dictionary partitions"
+#endif
+
+// Detections queued on one shard, a power of two. The main task waits for
+// space when a shard falls this far behind.
+#define OBJECT_SHARD_QUEUE_DEPTH              128
+#define OBJECT_SHARD_QUEUE_MASK               (OBJECT_SHARD_QUEUE_DEPTH - 1)
+
+// Samples one shard prepares for publication per cycle, the rest wait for the next cycle
+#define OBJECT_SHARD_OUTPUT_RECORDS           512
+
+#define OBJECT_SHARD_TASK_STACK               32768
+#define OBJECT_SHARD_TASK_PRIORITY            100
+
+typedef char OBJECT_Shard_Queue_Check_t[((OBJECT_SHARD_QUEUE_DEPTH & OBJECT_SHARD_QUEUE_MASK) == 0) ? 1 : -1];
+
+// Every shard's share of the sample budget covers its classes' reservations
+typedef char OBJECT_Shard_Budget_Check_t[((OBJECT_SAMPLE_POOL_SIZE / OBJECT_SHARD_PARTITIONS) >=
+                                          (((MAX_OBJECT_TRACKING + OBJECT_SHARD_PARTITIONS - 1) /
+                                            OBJECT_SHARD_PARTITIONS) * OBJECT_CLASS_MIN_SAMPLES)) ? 1 : -1];
+
+// One routed detection
+typedef struct
+{
+    rover_state             state;
+    OBJECT_Latency_Trace_t  trace;
+
+    // Ingest frame, consecutive entries of a frame are committed together
+    uint32                  frame;
+} OBJECT_Shard_Entry_t;
+
+// One sample prepared for publication. The pointers stay valid until the
+// shards run again, which is after the main task published.
+typedef struct
+{
+    Object_Node_t                   *node;
+    const OBJECT_Kinematics_Data_t  *kinematics;
+    const OBJECT_Pose_Data_t        *pose;
+
+    // Fixed point form, compact format only
+    OBJECT_History_Sample_t         sample;
+} OBJECT_Shard_Record_t;
+
+// Unpublished samples of one class: the live nodes 'first' to 'last' and
+// the 'pending' records of those the subscription wants
+typedef struct
+{
+    Object_Node_t   *first;
+    Object_Node_t   *last;
+    uint32          first_record;
+    uint32          pending;
+    uint32          filtered;
+} OBJECT_Shard_Class_Out_t;
+
+typedef struct
+{
+    // Indexed by class id, only the shard's own classes are filled
+    OBJECT_Shard_Class_Out_t    classes[MAX_OBJECT_TRACKING];
+
+    OBJECT_Shard_Record_t       records[OBJECT_SHARD_OUTPUT_RECORDS];
+    uint32                      record_count;
+} OBJECT_Shard_Output_t;
+
+typedef struct
+{
+    // Detections in ingest order. 'head' is advanced by the shard, 'tail'
+    // by the main task once per routed frame.
+    OBJECT_Shard_Entry_t    queue[OBJECT_SHARD_QUEUE_DEPTH];
+    uint32                  head;
+    uint32                  tail;
+
+    // Set by the main task before it waits for space in a full queue
+    uint32                  producer_waiting;
+
+    uint32                  work_sem_id;
+    uint32                  space_sem_id;
+    uint32                  task_id;
+
+    uint32                  index;
+
+    // Last cycle this shard completed
+    uint32                  cycle;
+
+    // Snapshot readers of the shard's histories and the samples they hold on to
+    OBJECT_Epoch_t          epoch;
+
+    // The shard's share of the sample budget
+    OBJECT_Sample_Pool_t    pool;
+
+    // Samples dropped because nothing could be evicted, and samples evicted
+    uint32                  empty_count;
+    uint32                  evicted_count;
+
+    // Filled at the end of every cycle, read by the main task while the shard is idle
+    OBJECT_Shard_Output_t   output;
+} OBJECT_Shard_t;
+
+typedef struct
+{
+    OBJECT_Shard_t  shards[OBJECT_SHARD_PARTITIONS];
+    uint32          shard_count;
+
+    // Shard tasks, 0 when the main task runs the single shard
+    uint32          task_count;
+
+    // Ingest frames routed and cycles started, written by the main task
+    uint32          frame;
+    uint32          cycle;
+
+    // Given once by each shard task that completed a cycle
+    uint32          done_sem_id;
+
+    // Hands each starting task its shard index
+    uint32          mutex_id;
+    uint32          started;
+} OBJECT_Shard_Pool_t;
+
+int32           OBJECT_Shard_Init(OBJECT_Shard_Pool_t *pool, Object_Node_t *nodes);
+void            OBJECT_Shard_Route(OBJECT_Shard_Pool_t *pool, const rover_array *rovers,
+                                   const OBJECT_Latency_Trace_t *trace);
+void            OBJECT_Shard_Cycle(OBJECT_Shard_Pool_t *pool);
+OBJECT_Shard_t *OBJECT_Shard_Of_Class(OBJECT_Shard_Pool_t *pool, uint8 class_id);
+
+#endif /* _object_tracking_app_shard_h_ */
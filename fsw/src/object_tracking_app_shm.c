@@ -0,0 +1,234 @@
+/*******************************************************************************
+**
+**      GSC-18128-1, "Core Flight Executive Version 6.7"
+**
+**      Copyright (c) 2006-2019 United States Government as represented by
+**      the Administrator of the National Aeronautics and Space Administration.
+**      All Rights Reserved.
+**
+**      Licensed under the Apache License, Version 2.0 (the "License");
+**      you may not use this file except in compliance with the License.
+**      You may obtain a copy of the License at
+**
+**        http://www.apache.org/licenses/LICENSE-2.0
+**
+**      Unless required by applicable law or agreed to in writing, software
+**      distributed under the License is distributed on an "AS IS" BASIS,
+**      WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**      See the License for the specific language governing permissions and
+**      limitations under the License.
+**
+** File: object_tracking_app_shm.c
+**
+** Purpose:
+**   Reads ROS2-YOLO detection frames in place from the shared-memory ring
+**   written by the ROS2 bridge, replacing the per-frame JSON file ingest.
+**
+*******************************************************************************/
+
+/*
+** Include Files:
+*/
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "object_tracking_app_events.h"
+#include "object_tracking_app.h"
+
+extern OBJECT_TrackerData_t OBJECT_TrackerData;
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  OBJECT_Shm_Overrun                                                 */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Records frames the writer overwrote before they were read          */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * *  * *  * * * * */
+static void OBJECT_Shm_Overrun(uint64 lostFrames, uint64 sequence){
+
+    OBJECT_TrackerData.IngestOverrunCount += (uint32) lostFrames;
+
+    CFE_EVS_SendEvent(OBJECT_SHM_OVERRUN_ERR_EID,
+                      CFE_EVS_EventType_ERROR,
+                      "SHM ring overrun: %lu frame(s) lost at sequence %lu",
+                      (unsigned long) lostFrames,
+                      (unsigned long) sequence);
+
+} /* End of OBJECT_Shm_Overrun */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  OBJECT_Shm_Attach                                                  */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Maps the ring read-only once the ROS2 bridge has created it        */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * *  * *  * * * * */
+bool OBJECT_Shm_Attach(OBJECT_ShmReader_t *reader){
+    struct stat ringStat;
+    OBJECT_ShmRing_t *ring;
+    int fd;
+
+    fd = shm_open(OBJECT_SHM_RING_NAME, O_RDONLY, 0);
+    if(fd < 0){
+        // The bridge may simply not be running yet - only report it once
+        if(!reader->missingReported){
+            CFE_EVS_SendEvent(OBJECT_SHM_INF_EID,
+                              CFE_EVS_EventType_INFORMATION,
+                              "SHM ring %s not available yet",
+                              OBJECT_SHM_RING_NAME);
+            reader->missingReported = true;
+        }
+
+        return(false);
+    }
+
+    // The writer sizes the object before publishing the header
+    if((fstat(fd, &ringStat) != 0) || (ringStat.st_size < (off_t) OBJECT_SHM_RING_SIZE)){
+        close(fd);
+        return(false);
+    }
+
+    ring = mmap(NULL, OBJECT_SHM_RING_SIZE, PROT_READ, MAP_SHARED, fd, 0);
+    if(ring == MAP_FAILED){
+        CFE_EVS_SendEvent(OBJECT_SHM_ERR_EID,
+                          CFE_EVS_EventType_ERROR,
+                          "SHM ring %s could not be mapped",
+                          OBJECT_SHM_RING_NAME);
+        close(fd);
+        return(false);
+    }
+
+    // Layout must match this build of 'object_tracking_shm_ring.h'
+    if((OBJECT_SHM_LOAD_ACQUIRE(&ring->header.magic) != OBJECT_SHM_RING_MAGIC) ||
+       (ring->header.version != OBJECT_SHM_RING_VERSION) ||
+       (ring->header.slot_count != OBJECT_SHM_RING_SLOTS) ||
+       (ring->header.slot_size != sizeof(OBJECT_ShmSlot_t))){
+        CFE_EVS_SendEvent(OBJECT_SHM_ERR_EID,
+                          CFE_EVS_EventType_ERROR,
+                          "SHM ring layout mismatch: version %u, %u slots of %lu bytes",
+                          (unsigned int) ring->header.version,
+                          (unsigned int) ring->header.slot_count,
+                          (unsigned long) ring->header.slot_size);
+        munmap(ring, OBJECT_SHM_RING_SIZE);
+        close(fd);
+        return(false);
+    }
+
+    reader->fd = fd;
+    reader->ring = ring;
+    reader->generation = OBJECT_SHM_LOAD_ACQUIRE(&ring->header.generation);
+
+    // Frames published before the tracker started are not replayed
+    reader->next_sequence = OBJECT_SHM_LOAD_ACQUIRE(&ring->header.head);
+
+    CFE_EVS_SendEvent(OBJECT_SHM_INF_EID,
+                      CFE_EVS_EventType_INFORMATION,
+                      "SHM ring %s attached, generation %lu",
+                      OBJECT_SHM_RING_NAME,
+                      (unsigned long) reader->generation);
+
+    return(true);
+
+} /* End of OBJECT_Shm_Attach */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  OBJECT_Shm_Detach                                                  */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Unmaps the ring                                                    */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * *  * *  * * * * */
+void OBJECT_Shm_Detach(OBJECT_ShmReader_t *reader){
+
+    if(reader->ring != NULL){
+        munmap(reader->ring, OBJECT_SHM_RING_SIZE);
+        reader->ring = NULL;
+    }
+
+    if(reader->fd >= 0){
+        close(reader->fd);
+        reader->fd = -1;
+    }
+
+} /* End of OBJECT_Shm_Detach */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  OBJECT_Shm_Ingest                                                  */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Commits every newly published frame to the object histories,       */
+/*         reading each slot in place and detecting writer overruns           */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * *  * *  * * * * */
+void OBJECT_Shm_Ingest(OBJECT_ShmReader_t *reader){
+    OBJECT_ShmRing_t *ring;
+    OBJECT_ShmSlot_t *slot;
+    uint32 generation;
+    uint64 head;
+    uint64 expected;
+    int    frames = 0;
+
+    if((reader->ring == NULL) && !OBJECT_Shm_Attach(reader)){
+        return;
+    }
+
+    ring = reader->ring;
+
+    // Header is being re-initialized by a restarting writer
+    if(OBJECT_SHM_LOAD_ACQUIRE(&ring->header.magic) != OBJECT_SHM_RING_MAGIC){
+        return;
+    }
+
+    // Writer restarted - its sequence numbers start over
+    generation = OBJECT_SHM_LOAD_ACQUIRE(&ring->header.generation);
+    if(generation != reader->generation){
+        CFE_EVS_SendEvent(OBJECT_SHM_INF_EID,
+                          CFE_EVS_EventType_INFORMATION,
+                          "SHM ring writer restarted, generation %lu",
+                          (unsigned long) generation);
+
+        reader->generation = generation;
+        reader->next_sequence = 0;
+    }
+
+    head = OBJECT_SHM_LOAD_ACQUIRE(&ring->header.head);
+
+    // Writer lapped the reader - everything older than one ring length is gone
+    if((head - reader->next_sequence) > OBJECT_SHM_RING_SLOTS){
+        OBJECT_Shm_Overrun(head - OBJECT_SHM_RING_SLOTS - reader->next_sequence, reader->next_sequence);
+        reader->next_sequence = head - OBJECT_SHM_RING_SLOTS;
+    }
+
+    while((reader->next_sequence < head) && (frames < OBJECT_SHM_MAX_FRAMES_PER_CYCLE)){
+        slot = &ring->slots[reader->next_sequence & OBJECT_SHM_RING_MASK];
+        expected = OBJECT_SHM_SLOT_COMMITTED(reader->next_sequence);
+
+        // Slot already reused for a newer frame
+        if(OBJECT_SHM_LOAD_ACQUIRE(&slot->sequence) != expected){
+            OBJECT_Shm_Overrun(1, reader->next_sequence++);
+            continue;
+        }
+
+        // Parses straight out of the slot, no intermediate copy
+        OBJECT_TrackerData.IngestTrace.arrival_us = OBJECT_Latency_Now();
+        OBJECT_Frame_To_Rovers(&slot->frame, &OBJECT_TrackerData.IngestRovers);
+        OBJECT_TrackerData.IngestTrace.parsed_us = OBJECT_Latency_Now();
+
+        // Slot was overwritten while it was being read, the parsed frame is torn
+        OBJECT_SHM_FENCE_ACQUIRE();
+        if(slot->sequence != expected){
+            OBJECT_Shm_Overrun(1, reader->next_sequence++);
+            continue;
+        }
+
+        reader->next_sequence++;
+
+        OBJECT_Commit_Rovers(&OBJECT_TrackerData.IngestRovers);
+
+        OBJECT_TrackerData.IngestFrameCount++;
+        frames++;
+    }
+
+} /* End of OBJECT_Shm_Ingest */
@@ -0,0 +1,58 @@
+/*******************************************************************************
+**
+**      GSC-18128-1, "Core Flight Executive Version 6.7"
+**
+**      Copyright (c) 2006-2019 United States Government as represented by
+**      the Administrator of the National Aeronautics and Space Administration.
+**      All Rights Reserved.
+**
+**      Licensed under the Apache License, Version 2.0 (the "License");
+**      you may not use this file except in compliance with the License.
+**      You may obtain a copy of the License at
+**
+**        http://www.apache.org/licenses/LICENSE-2.0
+**
+**      Unless required by applicable law or agreed to in writing, software
+**      distributed under the License is distributed on an "AS IS" BASIS,
+**      WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**      See the License for the specific language governing permissions and
+**      limitations under the License.
+**
+** File: object_tracking_app_shm.h
+**
+** Purpose:
+**   Reader side of the ROS2 bridge shared-memory ring ingest.
+**
+*******************************************************************************/
+
+#ifndef _object_tracking_app_shm_h_
+#define _object_tracking_app_shm_h_
+
+#include "common_types.h"
+
+#include "object_tracking_shm_ring.h"
+
+// Maximum amount of frames committed per main loop cycle, the rest wait in the ring
+#define OBJECT_SHM_MAX_FRAMES_PER_CYCLE       16
+
+typedef struct
+{
+    // Mapped ring, NULL until the ROS2 bridge has created it
+    int                 fd;
+    OBJECT_ShmRing_t    *ring;
+
+    // Writer generation the reader is synchronized to
+    uint32              generation;
+
+    // Sequence number of the next frame to read
+    uint64              next_sequence;
+
+    // Avoids repeating the 'ring not available' event every cycle
+    bool                missingReported;
+} OBJECT_ShmReader_t;
+
+bool  OBJECT_Shm_Attach(OBJECT_ShmReader_t *reader);
+void  OBJECT_Shm_Detach(OBJECT_ShmReader_t *reader);
+void  OBJECT_Shm_Ingest(OBJECT_ShmReader_t *reader);
+
+#endif /* _object_tracking_app_shm_h_ */
@@ -0,0 +1,260 @@
+/*******************************************************************************
+**
+**      GSC-18128-1, "Core Flight Executive Version 6.7"
+**
+**      Copyright (c) 2006-2019 United States Government as represented by
+**      the Administrator of the National Aeronautics and Space Administration.
+**      All Rights Reserved.
+**
+**      Licensed under the Apache License, Version 2.0 (the "License");
+**      you may not use this file except in compliance with the License.
+**      You may obtain a copy of the License at
+**
+**        http://www.apache.org/licenses/LICENSE-2.0
+**
+**      Unless required by applicable law or agreed to in writing, software
+**      distributed under the License is distributed on an "AS IS" BASIS,
+**      WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**      See the License for the specific language governing permissions and
+**      limitations under the License.
+**
+** File: object_tracking_app_socket.c
+**
+** Purpose:
+**   Receives ROS2-YOLO detection frames as local datagrams (Unix-domain or
+**   loopback UDP) for detectors running in a separate container. Every
+**   pending datagram is drained each cycle with batched receive calls.
+**
+*******************************************************************************/
+
+/*
+** Include Files:
+*/
+#define _GNU_SOURCE
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+
+#include "object_tracking_app_events.h"
+#include "object_tracking_app.h"
+
+extern OBJECT_TrackerData_t OBJECT_TrackerData;
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  OBJECT_Socket_Open                                                 */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Binds the non-blocking datagram socket                             */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * *  * *  * * * * */
+bool OBJECT_Socket_Open(OBJECT_SocketReader_t *reader){
+    struct sockaddr_un unixAddr;
+    struct sockaddr_in udpAddr;
+    int    rcvBuf = OBJECT_SOCKET_RCVBUF;
+    int    status;
+
+    if(OBJECT_SOCKET_UNIX_PATH[0] != '\0'){
+        reader->fd = socket(AF_UNIX, SOCK_DGRAM, 0);
+    } else {
+        reader->fd = socket(AF_INET, SOCK_DGRAM, 0);
+    }
+
+    if(reader->fd < 0){
+        CFE_EVS_SendEvent(OBJECT_SOCKET_ERR_EID,
+                          CFE_EVS_EventType_ERROR,
+                          "Ingest socket could not be created, errno = %d",
+                          errno);
+        return(false);
+    }
+
+    // Never block the main loop, pending datagrams are polled every cycle
+    fcntl(reader->fd, F_SETFL, fcntl(reader->fd, F_GETFL, 0) | O_NONBLOCK);
+    setsockopt(reader->fd, SOL_SOCKET, SO_RCVBUF, &rcvBuf, sizeof(rcvBuf));
+
+    if(OBJECT_SOCKET_UNIX_PATH[0] != '\0'){
+        memset(&unixAddr, 0, sizeof(unixAddr));
+        unixAddr.sun_family = AF_UNIX;
+        strncpy(unixAddr.sun_path, OBJECT_SOCKET_UNIX_PATH, sizeof(unixAddr.sun_path) - 1);
+
+        // Stale socket file from a previous run
+        unlink(OBJECT_SOCKET_UNIX_PATH);
+
+        status = bind(reader->fd, (struct sockaddr *) &unixAddr, sizeof(unixAddr));
+    } else {
+        memset(&udpAddr, 0, sizeof(udpAddr));
+        udpAddr.sin_family = AF_INET;
+        udpAddr.sin_port = htons(OBJECT_SOCKET_UDP_PORT);
+        inet_pton(AF_INET, OBJECT_SOCKET_UDP_ADDR, &udpAddr.sin_addr);
+
+        status = bind(reader->fd, (struct sockaddr *) &udpAddr, sizeof(udpAddr));
+    }
+
+    if(status != 0){
+        CFE_EVS_SendEvent(OBJECT_SOCKET_ERR_EID,
+                          CFE_EVS_EventType_ERROR,
+                          "Ingest socket could not be bound, errno = %d",
+                          errno);
+        close(reader->fd);
+        reader->fd = -1;
+        return(false);
+    }
+
+    CFE_EVS_SendEvent(OBJECT_SOCKET_INF_EID,
+                      CFE_EVS_EventType_INFORMATION,
+                      "Ingest socket listening on %s",
+                      (OBJECT_SOCKET_UNIX_PATH[0] != '\0') ? OBJECT_SOCKET_UNIX_PATH : OBJECT_SOCKET_UDP_ADDR);
+
+    return(true);
+
+} /* End of OBJECT_Socket_Open */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  OBJECT_Socket_Close                                                */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Closes the ingest socket                                           */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * *  * *  * * * * */
+void OBJECT_Socket_Close(OBJECT_SocketReader_t *reader){
+
+    if(reader->fd >= 0){
+        close(reader->fd);
+        reader->fd = -1;
+
+        if(OBJECT_SOCKET_UNIX_PATH[0] != '\0'){
+            unlink(OBJECT_SOCKET_UNIX_PATH);
+        }
+    }
+
+} /* End of OBJECT_Socket_Close */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  OBJECT_Socket_Error                                                */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Counts a failed receive. An empty socket isn't an error, and only  */
+/*         the first real one is reported so a dead socket doesn't flood      */
+/*         the ground.                                                        */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * *  * *  * * * * */
+static void OBJECT_Socket_Error(OBJECT_SocketReader_t *reader){
+
+    if((errno == EAGAIN) || (errno == EWOULDBLOCK)){
+        return;
+    }
+
+    if(reader->error_count++ == 0){
+        CFE_EVS_SendEvent(OBJECT_SOCKET_ERR_EID,
+                          CFE_EVS_EventType_ERROR,
+                          "Ingest socket receive failed, errno = %d",
+                          errno);
+    }
+
+} /* End of OBJECT_Socket_Error */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  OBJECT_Socket_Receive                                              */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Pulls up to 'limit' datagrams (at most one batch) into the frame   */
+/*         buffers and records their lengths. Returns the datagram count, 0   */
+/*         when empty or on a receive error.                                  */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * *  * *  * * * * */
+static int OBJECT_Socket_Receive(OBJECT_SocketReader_t *reader, uint32 *lengths, int limit){
+    int received;
+    int itr;
+
+    if(limit > OBJECT_SOCKET_BATCH){
+        limit = OBJECT_SOCKET_BATCH;
+    }
+
+#ifdef __linux__
+    // One system call for the whole batch
+    struct mmsghdr messages[OBJECT_SOCKET_BATCH];
+    struct iovec   vectors[OBJECT_SOCKET_BATCH];
+
+    memset(messages, 0, sizeof(messages));
+    for(itr = 0; itr < OBJECT_SOCKET_BATCH; itr++){
+        vectors[itr].iov_base = &reader->frames[itr];
+        vectors[itr].iov_len = sizeof(reader->frames[itr]);
+        messages[itr].msg_hdr.msg_iov = &vectors[itr];
+        messages[itr].msg_hdr.msg_iovlen = 1;
+    }
+
+    received = recvmmsg(reader->fd, messages, limit, MSG_DONTWAIT, NULL);
+    if(received < 0){
+        OBJECT_Socket_Error(reader);
+        received = 0;
+    }
+
+    for(itr = 0; itr < received; itr++){
+        // Oversized datagrams are cut short - flag them as malformed
+        lengths[itr] = (messages[itr].msg_hdr.msg_flags & MSG_TRUNC) ? 0 : messages[itr].msg_len;
+    }
+#else
+    ssize_t length;
+
+    for(received = 0; received < limit; received++){
+        length = recv(reader->fd, &reader->frames[received], sizeof(reader->frames[received]), MSG_DONTWAIT);
+        if(length < 0){
+            OBJECT_Socket_Error(reader);
+            break;
+        }
+        lengths[received] = (uint32) length;
+    }
+    (void) itr;
+#endif
+
+    return(received);
+
+} /* End of OBJECT_Socket_Receive */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  OBJECT_Socket_Ingest                                               */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Takes the pending datagrams, up to the cycle's limit, and commits  */
+/*         each frame through the same insertion path as the file ingest      */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * *  * *  * * * * */
+void OBJECT_Socket_Ingest(OBJECT_SocketReader_t *reader){
+    uint32 lengths[OBJECT_SOCKET_BATCH];
+    int    frames = 0;
+    int    received;
+    int    itr;
+
+    if((reader->fd < 0) && !OBJECT_Socket_Open(reader)){
+        return;
+    }
+
+    do {
+        received = OBJECT_Socket_Receive(reader, lengths, OBJECT_SOCKET_MAX_FRAMES_PER_CYCLE - frames);
+        frames += received;
+        OBJECT_TrackerData.IngestTrace.arrival_us = OBJECT_Latency_Now();
+
+        for(itr = 0; itr < received; itr++){
+            // Length has to match the detection count the sender claims
+            if((lengths[itr] < OBJECT_FRAME_HDR_SIZE) ||
+               (reader->frames[itr].detection_count > OBJECT_FRAME_MAX_DETECTIONS) ||
+               (lengths[itr] != OBJECT_FRAME_SIZE(reader->frames[itr].detection_count))){
+                OBJECT_TrackerData.IngestMalformedCount++;
+                continue;
+            }
+
+            OBJECT_Frame_To_Rovers(&reader->frames[itr], &OBJECT_TrackerData.IngestRovers);
+            OBJECT_TrackerData.IngestTrace.parsed_us = OBJECT_Latency_Now();
+            OBJECT_Commit_Rovers(&OBJECT_TrackerData.IngestRovers);
+
+            OBJECT_TrackerData.IngestFrameCount++;
+        }
+
+    // A short batch means the socket is empty. A sender keeping pace would
+    // never let it empty, so the rest of the cycle isn't held up past the limit.
+    } while((received == OBJECT_SOCKET_BATCH) && (frames < OBJECT_SOCKET_MAX_FRAMES_PER_CYCLE));
+
+} /* End of OBJECT_Socket_Ingest */
@@ -0,0 +1,68 @@
+/*******************************************************************************
+**
+**      GSC-18128-1, "Core Flight Executive Version 6.7"
+**
+**      Copyright (c) 2006-2019 United States Government as represented by
+**      the Administrator of the National Aeronautics and Space Administration.
+**      All Rights Reserved.
+**
+**      Licensed under the Apache License, Version 2.0 (the "License");
+**      you may not use this file except in compliance with the License.
+**      You may obtain a copy of the License at
+**
+**        http://www.apache.org/licenses/LICENSE-2.0
+**
+**      Unless required by applicable law or agreed to in writing, software
+**      distributed under the License is distributed on an "AS IS" BASIS,
+**      WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**      See the License for the specific language governing permissions and
+**      limitations under the License.
+**
+** File: object_tracking_app_socket.h
+**
+** Purpose:
+**   Non-blocking local datagram ingest, one 'OBJECT_Frame_t' per datagram.
+**
+*******************************************************************************/
+
+#ifndef _object_tracking_app_socket_h_
+#define _object_tracking_app_socket_h_
+
+#include "common_types.h"
+
+#include "object_tracking_frame.h"
+
+// Unix-domain datagram socket path, leave empty to use loopback UDP instead
+#define OBJECT_SOCKET_UNIX_PATH               ""
+
+// Loopback UDP endpoint the detector sends frames to
+#define OBJECT_SOCKET_UDP_ADDR                "127.0.0.1"
+#define OBJECT_SOCKET_UDP_PORT                5470
+
+// Datagrams pulled per receive call, calls repeat until the socket is empty
+// or the cycle's limit is reached
+#define OBJECT_SOCKET_BATCH                   16
+
+// Most datagrams taken per cycle, the rest wait in the socket for the next one
+#define OBJECT_SOCKET_MAX_FRAMES_PER_CYCLE    64
+
+// Kernel receive buffer, sized to hold a burst of full frames
+#define OBJECT_SOCKET_RCVBUF                  (256 * 1024)
+
+typedef struct
+{
+    // Socket descriptor, -1 until opened
+    int                 fd;
+
+    // Receive buffers for one batch of datagrams
+    OBJECT_Frame_t      frames[OBJECT_SOCKET_BATCH];
+
+    // Failed receives, only the first one is reported
+    uint32              error_count;
+} OBJECT_SocketReader_t;
+
+bool  OBJECT_Socket_Open(OBJECT_SocketReader_t *reader);
+void  OBJECT_Socket_Close(OBJECT_SocketReader_t *reader);
+void  OBJECT_Socket_Ingest(OBJECT_SocketReader_t *reader);
+
+#endif /* _object_tracking_app_socket_h_ */
@@ -0,0 +1,241 @@
+/*******************************************************************************
+**
+**      GSC-18128-1, "Core Flight Executive Version 6.7"
+**
+**      Copyright (c) 2006-2019 United States Government as represented by
+**      the Administrator of the National Aeronautics and Space Administration.
+**      All Rights Reserved.
+**
+**      Licensed under the Apache License, Version 2.0 (the "License");
+**      you may not use this file except in compliance with the License.
+**      You may obtain a copy of the License at
+**
+**        http://www.apache.org/licenses/LICENSE-2.0
+**
+**      Unless required by applicable law or agreed to in writing, software
+**      distributed under the License is distributed on an "AS IS" BASIS,
+**      WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**      See the License for the specific language governing permissions and
+**      limitations under the License.
+**
+**
+** File: object_tracking_app_stats.c
+**
+** Purpose:
+**   Keeps detection count, rate, mean/variance, min/max and last-seen time
+**   of every class and track, updated in O(1) per sample, and sends them
+**   in a low-rate summary so consumers don't have to walk the histories.
+**
+*******************************************************************************/
+
+/*
+** Include Files:
+*/
+#include <math.h>
+
+#include "object_tracking_app_msgids.h"
+#include "object_tracking_app_stats.h"
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  OBJECT_Welford_Add                                                 */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Adds one value to a running mean/variance                          */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * *  * *  * * * * */
+static void OBJECT_Welford_Add(OBJECT_Welford_t *acc, double value){
+    double delta = value - acc->mean;
+
+    acc->count++;
+    acc->mean += delta / acc->count;
+    acc->m2 += delta * (value - acc->mean);
+
+    if((acc->count == 1) || (value < acc->min)){
+        acc->min = value;
+    }
+    if((acc->count == 1) || (value > acc->max)){
+        acc->max = value;
+    }
+
+} /* End of OBJECT_Welford_Add */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  OBJECT_Welford_Stddev                                              */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Sample standard deviation, 0 below two values                      */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * *  * *  * * * * */
+static double OBJECT_Welford_Stddev(const OBJECT_Welford_t *acc){
+
+    return((acc->count > 1) ? sqrt(acc->m2 / (acc->count - 1)) : 0.0);
+
+} /* End of OBJECT_Welford_Stddev */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  OBJECT_Stats_Acc_Add                                               */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Adds one detection to a class or track accumulator                 */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * *  * *  * * * * */
+static void OBJECT_Stats_Acc_Add(OBJECT_Stats_Acc_t *acc, const rover_state *state, uint64 now){
+
+    acc->count++;
+    acc->last_seen_us = now;
+    acc->class_id = state->class_id;
+
+    OBJECT_Welford_Add(&acc->confidence, state->confidenceScore);
+    OBJECT_Welford_Add(&acc->distance, state->distance);
+
+} /* End of OBJECT_Stats_Acc_Add */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  OBJECT_Stats_Init                                                  */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Clears every accumulator and initializes the summary packet        */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * *  * *  * * * * */
+void OBJECT_Stats_Init(OBJECT_Stats_t *stats){
+
+    memset(stats, 0, sizeof(*stats));
+
+    CFE_SB_InitMsg(&stats->msg,
+                   OBJECT_TRACKER_STATS_PUB,
+                   sizeof(stats->msg),
+                   true);
+
+} /* End of OBJECT_Stats_Init */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  OBJECT_Stats_Update                                                */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Adds one ingested detection to its class and, when it has a        */
+/*         track id, to its track                                             */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * *  * *  * * * * */
+void OBJECT_Stats_Update(OBJECT_Stats_t *stats, uint16 track_id, const rover_state *state, uint64 now){
+
+    if(state->class_id < MAX_OBJECT_TRACKING){
+        OBJECT_Stats_Acc_Add(&stats->classes[state->class_id], state, now);
+    }
+
+    if((track_id != 0) && (track_id <= OBJECT_DICT_MAX_TRACKS)){
+        OBJECT_Stats_Acc_Add(&stats->tracks[track_id - 1], state, now);
+    }
+
+} /* End of OBJECT_Stats_Update */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  OBJECT_Stats_Clear_Track                                           */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Forgets a deleted track, its id may be reused                      */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * *  * *  * * * * */
+void OBJECT_Stats_Clear_Track(OBJECT_Stats_t *stats, uint16 track_id){
+
+    if((track_id != 0) && (track_id <= OBJECT_DICT_MAX_TRACKS)){
+        memset(&stats->tracks[track_id - 1], 0, sizeof(OBJECT_Stats_Acc_t));
+    }
+
+} /* End of OBJECT_Stats_Clear_Track */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  OBJECT_Stats_Fill                                                  */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Converts an accumulator to its telemetry entry                     */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * *  * *  * * * * */
+static void OBJECT_Stats_Fill(OBJECT_Stats_Acc_t *acc, uint16 track_id, double elapsed, uint64 now,
+                              OBJECT_Stats_Entry_t *entry){
+
+    entry->track_id = track_id;
+    entry->class_id = acc->class_id;
+    entry->spare = 0;
+    entry->count = acc->count;
+    entry->rate_hz = (elapsed > 0.0) ? (float) ((acc->count - acc->reported_count) / elapsed) : 0.0f;
+    entry->last_seen_ms = (uint32) ((now - acc->last_seen_us) / 1000);
+
+    entry->confidence_mean = (float) acc->confidence.mean;
+    entry->confidence_stddev = (float) OBJECT_Welford_Stddev(&acc->confidence);
+    entry->confidence_min = (float) acc->confidence.min;
+    entry->confidence_max = (float) acc->confidence.max;
+
+    entry->distance_mean = (float) acc->distance.mean;
+    entry->distance_stddev = (float) OBJECT_Welford_Stddev(&acc->distance);
+    entry->distance_min = (float) acc->distance.min;
+    entry->distance_max = (float) acc->distance.max;
+
+    acc->reported_count = acc->count;
+
+} /* End of OBJECT_Stats_Fill */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  OBJECT_Stats_Report                                                */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Called every cycle. Every OBJECT_STATS_REPORT_CYCLES cycles        */
+/*         sends the classes and tracks seen so far, paged.                   */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * *  * *  * * * * */
+void OBJECT_Stats_Report(OBJECT_Stats_t *stats, uint64 now){
+    OBJECT_Stats_Payload_t *payload = &stats->msg.Payload;
+    OBJECT_Stats_Acc_t *acc;
+    double elapsed;
+    uint16 total = 0;
+    uint16 sent = 0;
+    uint16 itr;
+
+    if(++stats->cycle < OBJECT_STATS_REPORT_CYCLES){
+        return;
+    }
+    stats->cycle = 0;
+
+    // Classes then tracks, in one index space
+    for(itr = 0; itr < (MAX_OBJECT_TRACKING + OBJECT_DICT_MAX_TRACKS); itr++){
+        acc = (itr < MAX_OBJECT_TRACKING) ? &stats->classes[itr] : &stats->tracks[itr - MAX_OBJECT_TRACKING];
+        if(acc->count > 0){
+            total++;
+        }
+    }
+
+    if(total == 0){
+        stats->reported_us = now;
+        return;
+    }
+
+    elapsed = (stats->reported_us != 0) ? ((double) (now - stats->reported_us) / 1000000.0) : 0.0;
+
+    payload->total_entries = total;
+    payload->first_entry = 0;
+    payload->entry_count = 0;
+
+    for(itr = 0; itr < (MAX_OBJECT_TRACKING + OBJECT_DICT_MAX_TRACKS); itr++){
+        acc = (itr < MAX_OBJECT_TRACKING) ? &stats->classes[itr] : &stats->tracks[itr - MAX_OBJECT_TRACKING];
+        if(acc->count == 0){
+            continue;
+        }
+
+        OBJECT_Stats_Fill(acc, (itr < MAX_OBJECT_TRACKING) ? 0 : (uint16) (itr - MAX_OBJECT_TRACKING + 1),
+                          elapsed, now, &payload->entries[payload->entry_count++]);
+        sent++;
+
+        if((payload->entry_count == OBJECT_STATS_MAX_ENTRIES) || (sent == total)){
+            CFE_SB_SetTotalMsgLength((CFE_SB_MsgPtr_t) &stats->msg,
+                                     sizeof(stats->msg) -
+                                     ((OBJECT_STATS_MAX_ENTRIES - payload->entry_count) * sizeof(OBJECT_Stats_Entry_t)));
+            CFE_SB_TimeStampMsg((CFE_SB_MsgPtr_t) &stats->msg);
+            CFE_SB_SendMsg((CFE_SB_MsgPtr_t) &stats->msg);
+
+            payload->first_entry = sent;
+            payload->entry_count = 0;
+        }
+    }
+
+    stats->reported_us = now;
+
+} /* End of OBJECT_Stats_Report */
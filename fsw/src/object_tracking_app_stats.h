@@ -0,0 +1,84 @@
+/*******************************************************************************
+**
+**      GSC-18128-1, "Core Flight Executive Version 6.7"
+**
+**      Copyright (c) 2006-2019 United States Government as represented by
+**      the Administrator of the National Aeronautics and Space Administration.
+**      All Rights Reserved.
+**
+**      Licensed under the Apache License, Version 2.0 (the "License");
+**      you may not use this file except in compliance with the License.
+**      You may obtain a copy of the License at
+**
+**        http://www.apache.org/licenses/LICENSE-2.0
+**
+**      Unless required by applicable law or agreed to in writing, software
+**      distributed under the License is distributed on an "AS IS" BASIS,
+**      WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**      See the License for the specific language governing permissions and
+**      limitations under the License.
+**
+**
+** File: object_tracking_app_stats.h
+**
+** Purpose:
+**   Running per-class and per-track detection statistics.
+**
+*******************************************************************************/
+
+#ifndef _object_tracking_app_stats_h_
+#define _object_tracking_app_stats_h_
+
+#include "cfe.h"
+
+#include "object_tracking_app_msg.h"
+#include "object_tracking_app_compact.h"
+
+// Main loop cycles between two statistics summaries
+#define OBJECT_STATS_REPORT_CYCLES            40
+
+// Welford accumulator of one value
+typedef struct
+{
+    uint32      count;
+    double      mean;
+    double      m2;
+    double      min;
+    double      max;
+} OBJECT_Welford_t;
+
+typedef struct
+{
+    uint32              count;
+
+    // 'count' at the previous summary, for the rate
+    uint32              reported_count;
+
+    // cFE time of the last detection, microseconds
+    uint64              last_seen_us;
+
+    uint8               class_id;
+
+    OBJECT_Welford_t    confidence;
+    OBJECT_Welford_t    distance;
+} OBJECT_Stats_Acc_t;
+
+typedef struct
+{
+    // Indexed by 'class_id' and by track id - 1
+    OBJECT_Stats_Acc_t      classes[MAX_OBJECT_TRACKING];
+    OBJECT_Stats_Acc_t      tracks[OBJECT_DICT_MAX_TRACKS];
+
+    // cFE time of the previous summary, microseconds
+    uint64                  reported_us;
+    uint32                  cycle;
+
+    OBJECT_Stats_Packet_t   msg;
+} OBJECT_Stats_t;
+
+void OBJECT_Stats_Init(OBJECT_Stats_t *stats);
+void OBJECT_Stats_Update(OBJECT_Stats_t *stats, uint16 track_id, const rover_state *state, uint64 now);
+void OBJECT_Stats_Clear_Track(OBJECT_Stats_t *stats, uint16 track_id);
+void OBJECT_Stats_Report(OBJECT_Stats_t *stats, uint64 now);
+
+#endif /* _object_tracking_app_stats_h_ */
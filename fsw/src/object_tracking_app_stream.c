@@ -0,0 +1,281 @@
+/*******************************************************************************
+**
+**      GSC-18128-1, "Core Flight Executive Version 6.7"
+**
+**      Copyright (c) 2006-2019 United States Government as represented by
+**      the Administrator of the National Aeronautics and Space Administration.
+**      All Rights Reserved.
+**
+**      Licensed under the Apache License, Version 2.0 (the "License");
+**      you may not use this file except in compliance with the License.
+**      You may obtain a copy of the License at
+**
+**        http://www.apache.org/licenses/LICENSE-2.0
+**
+**      Unless required by applicable law or agreed to in writing, software
+**      distributed under the License is distributed on an "AS IS" BASIS,
+**      WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**      See the License for the specific language governing permissions and
+**      limitations under the License.
+**
+**
+** File: object_tracking_app_stream.c
+**
+** Purpose:
+**   Reads new detection records from the append-only stream file with one
+**   read per cycle. The byte offset of the next record survives restarts,
+**   and truncation or rotation of the stream restarts it at offset 0.
+**
+*******************************************************************************/
+
+/*
+** Include Files:
+*/
+#include <errno.h>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "object_tracking_app_events.h"
+#include "object_tracking_app.h"
+
+extern OBJECT_TrackerData_t OBJECT_TrackerData;
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  OBJECT_Stream_Save                                                 */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Persists the position, the file is kept open and rewritten         */
+/*         in place                                                           */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * *  * *  * * * * */
+static void OBJECT_Stream_Save(OBJECT_StreamReader_t *reader){
+
+    if(reader->position_fd >= 0){
+        if(pwrite(reader->position_fd, &reader->position, sizeof(reader->position), 0) != sizeof(reader->position)){
+            CFE_EVS_SendEvent(OBJECT_STREAM_ERR_EID,
+                              CFE_EVS_EventType_ERROR,
+                              "Stream position could not be saved, errno = %d",
+                              errno);
+        }
+    }
+
+} /* End of OBJECT_Stream_Save */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  OBJECT_Stream_Open                                                 */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Opens the stream and resumes at the saved position if it           */
+/*         belongs to the same file and is still inside it                    */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * *  * *  * * * * */
+bool OBJECT_Stream_Open(OBJECT_StreamReader_t *reader){
+    OBJECT_Stream_Position_t saved;
+    struct stat streamStat;
+
+    reader->fd = open(OBJECT_STREAM_PATH, O_RDONLY);
+    if(reader->fd < 0){
+        // The bridge may simply not be running yet - only report it once
+        if(!reader->missingReported){
+            CFE_EVS_SendEvent(OBJECT_STREAM_INF_EID,
+                              CFE_EVS_EventType_INFORMATION,
+                              "Stream %s not available yet",
+                              OBJECT_STREAM_PATH);
+            reader->missingReported = true;
+        }
+
+        return(false);
+    }
+
+    if(fstat(reader->fd, &streamStat) != 0){
+        close(reader->fd);
+        reader->fd = -1;
+        return(false);
+    }
+
+    if(reader->position_fd < 0){
+        reader->position_fd = open(OBJECT_STREAM_OFFSET_PATH, O_RDWR | O_CREAT, 0660);
+    }
+
+    memset(&reader->position, 0, sizeof(reader->position));
+    if((reader->position_fd >= 0) &&
+       (pread(reader->position_fd, &saved, sizeof(saved), 0) == sizeof(saved)) &&
+       (saved.inode == (uint64) streamStat.st_ino) &&
+       (saved.device == (uint64) streamStat.st_dev) &&
+       (saved.offset <= (uint64) streamStat.st_size)){
+        reader->position.offset = saved.offset;
+    }
+
+    reader->position.inode = (uint64) streamStat.st_ino;
+    reader->position.device = (uint64) streamStat.st_dev;
+    reader->resyncing = false;
+    OBJECT_Stream_Save(reader);
+
+    CFE_EVS_SendEvent(OBJECT_STREAM_INF_EID,
+                      CFE_EVS_EventType_INFORMATION,
+                      "Tailing stream %s from offset %lu",
+                      OBJECT_STREAM_PATH,
+                      (unsigned long) reader->position.offset);
+
+    return(true);
+
+} /* End of OBJECT_Stream_Open */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  OBJECT_Stream_Close                                                */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Closes the stream and the position file                            */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * *  * *  * * * * */
+void OBJECT_Stream_Close(OBJECT_StreamReader_t *reader){
+
+    if(reader->fd >= 0){
+        close(reader->fd);
+        reader->fd = -1;
+    }
+
+    if(reader->position_fd >= 0){
+        close(reader->position_fd);
+        reader->position_fd = -1;
+    }
+
+} /* End of OBJECT_Stream_Close */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  OBJECT_Stream_Read                                                 */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Reads from the position once and commits up to limit complete      */
+/*         records. Returns the number of frames committed.                   */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * *  * *  * * * * */
+static uint32 OBJECT_Stream_Read(OBJECT_StreamReader_t *reader, uint32 limit){
+    OBJECT_Stream_Record_t record;
+    uint32  frames = 0;
+    ssize_t length;
+    size_t  pos = 0;
+
+    length = pread(reader->fd, reader->buffer, sizeof(reader->buffer), (off_t) reader->position.offset);
+    if(length <= 0){
+        return(0);
+    }
+    OBJECT_TrackerData.IngestTrace.arrival_us = OBJECT_Latency_Now();
+
+    while(((size_t) length - pos >= sizeof(record)) && (frames < limit)){
+        memcpy(&record, &reader->buffer[pos], sizeof(record));
+
+        // Skips ahead a byte at a time until the next record header
+        if((record.magic != OBJECT_STREAM_RECORD_MAGIC) ||
+           (record.length < OBJECT_FRAME_HDR_SIZE) ||
+           (record.length > sizeof(OBJECT_Frame_t))){
+            if(!reader->resyncing){
+                OBJECT_TrackerData.IngestMalformedCount++;
+                reader->resyncing = true;
+            }
+            pos++;
+            continue;
+        }
+
+        // Rest of the record is still being written
+        if(((size_t) length - pos - sizeof(record)) < record.length){
+            break;
+        }
+
+        reader->resyncing = false;
+        memcpy(&reader->frame, &reader->buffer[pos + sizeof(record)], record.length);
+        pos += sizeof(record) + record.length;
+
+        // Length has to match the detection count the writer claims
+        if((reader->frame.detection_count > OBJECT_FRAME_MAX_DETECTIONS) ||
+           (record.length != OBJECT_FRAME_SIZE(reader->frame.detection_count))){
+            OBJECT_TrackerData.IngestMalformedCount++;
+            continue;
+        }
+
+        OBJECT_Frame_To_Rovers(&reader->frame, &OBJECT_TrackerData.IngestRovers);
+        OBJECT_TrackerData.IngestTrace.parsed_us = OBJECT_Latency_Now();
+        OBJECT_Commit_Rovers(&OBJECT_TrackerData.IngestRovers);
+
+        OBJECT_TrackerData.IngestFrameCount++;
+        frames++;
+    }
+
+    if(pos > 0){
+        reader->position.offset += pos;
+        OBJECT_Stream_Save(reader);
+    }
+
+    return(frames);
+
+} /* End of OBJECT_Stream_Read */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  OBJECT_Stream_Ingest                                               */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Commits the records appended since the last cycle, following       */
+/*         the stream through truncation and rotation                         */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * *  * *  * * * * */
+void OBJECT_Stream_Ingest(OBJECT_StreamReader_t *reader){
+    struct stat streamStat;
+    struct stat pathStat;
+    uint64      offset;
+    uint32      frames = 0;
+
+    if((reader->fd < 0) && !OBJECT_Stream_Open(reader)){
+        return;
+    }
+
+    // A different file at the path means the bridge rotated the stream
+    if((stat(OBJECT_STREAM_PATH, &pathStat) == 0) &&
+       ((pathStat.st_ino != (ino_t) reader->position.inode) ||
+        (pathStat.st_dev != (dev_t) reader->position.device))){
+
+        // Records still unread in the rotated file come first, until a read
+        // consumes nothing. Past the cycle cap the rest waits for the next cycle.
+        do{
+            offset = reader->position.offset;
+            frames += OBJECT_Stream_Read(reader, OBJECT_STREAM_MAX_FRAMES_PER_CYCLE - frames);
+            if(frames >= OBJECT_STREAM_MAX_FRAMES_PER_CYCLE){
+                return;
+            }
+        } while(reader->position.offset != offset);
+
+        // A record the writer never finished is left behind
+        if((fstat(reader->fd, &streamStat) == 0) && ((uint64) streamStat.st_size > reader->position.offset)){
+            OBJECT_TrackerData.IngestMalformedCount++;
+        }
+
+        CFE_EVS_SendEvent(OBJECT_STREAM_INF_EID,
+                          CFE_EVS_EventType_INFORMATION,
+                          "Stream %s rotated at offset %lu",
+                          OBJECT_STREAM_PATH,
+                          (unsigned long) reader->position.offset);
+
+        close(reader->fd);
+        reader->fd = -1;
+        if(!OBJECT_Stream_Open(reader)){
+            return;
+        }
+    }
+
+    // Truncated in place
+    if((fstat(reader->fd, &streamStat) == 0) && ((uint64) streamStat.st_size < reader->position.offset)){
+        CFE_EVS_SendEvent(OBJECT_STREAM_INF_EID,
+                          CFE_EVS_EventType_INFORMATION,
+                          "Stream %s truncated from offset %lu to %lu bytes",
+                          OBJECT_STREAM_PATH,
+                          (unsigned long) reader->position.offset,
+                          (unsigned long) streamStat.st_size);
+
+        reader->position.offset = 0;
+        reader->resyncing = false;
+        OBJECT_Stream_Save(reader);
+    }
+
+    OBJECT_Stream_Read(reader, OBJECT_STREAM_MAX_FRAMES_PER_CYCLE - frames);
+
+} /* End of OBJECT_Stream_Ingest */
@@ -0,0 +1,77 @@
+/*******************************************************************************
+**
+**      GSC-18128-1, "Core Flight Executive Version 6.7"
+**
+**      Copyright (c) 2006-2019 United States Government as represented by
+**      the Administrator of the National Aeronautics and Space Administration.
+**      All Rights Reserved.
+**
+**      Licensed under the Apache License, Version 2.0 (the "License");
+**      you may not use this file except in compliance with the License.
+**      You may obtain a copy of the License at
+**
+**        http://www.apache.org/licenses/LICENSE-2.0
+**
+**      Unless required by applicable law or agreed to in writing, software
+**      distributed under the License is distributed on an "AS IS" BASIS,
+**      WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**      See the License for the specific language governing permissions and
+**      limitations under the License.
+**
+**
+** File: object_tracking_app_stream.h
+**
+** Purpose:
+**   Tails the append-only detection stream file, see object_tracking_stream.h.
+**
+*******************************************************************************/
+
+#ifndef _object_tracking_app_stream_h_
+#define _object_tracking_app_stream_h_
+
+#include "common_types.h"
+
+#include "object_tracking_stream.h"
+
+// Bytes read per cycle, holds dozens of full frames
+#define OBJECT_STREAM_READ_SIZE               (64 * 1024)
+
+// Most frames committed per cycle
+#define OBJECT_STREAM_MAX_FRAMES_PER_CYCLE    64
+
+// Where the reader is, persisted after every cycle that consumed records
+typedef struct
+{
+    // Byte offset of the first unconsumed record
+    uint64              offset;
+
+    // Inode and device of the stream the offset belongs to
+    uint64              inode;
+    uint64              device;
+} OBJECT_Stream_Position_t;
+
+typedef struct
+{
+    // Stream and position file descriptors, -1 until opened
+    int                 fd;
+    int                 position_fd;
+
+    OBJECT_Stream_Position_t position;
+
+    // Only report a missing stream once
+    bool                missingReported;
+
+    // Skipping bytes after a bad record, counted as one malformed frame
+    bool                resyncing;
+
+    // Aligned copy of the record being decoded
+    OBJECT_Frame_t      frame;
+
+    uint8               buffer[OBJECT_STREAM_READ_SIZE];
+} OBJECT_StreamReader_t;
+
+bool  OBJECT_Stream_Open(OBJECT_StreamReader_t *reader);
+void  OBJECT_Stream_Close(OBJECT_StreamReader_t *reader);
+void  OBJECT_Stream_Ingest(OBJECT_StreamReader_t *reader);
+
+#endif /* _object_tracking_app_stream_h_ */
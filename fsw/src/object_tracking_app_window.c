@@ -0,0 +1,275 @@
+/*******************************************************************************
+**
+**      GSC-18128-1, "Core Flight Executive Version 6.7"
+**
+**      Copyright (c) 2006-2019 United States Government as represented by
+**      the Administrator of the National Aeronautics and Space Administration.
+**      All Rights Reserved.
+**
+**      Licensed under the Apache License, Version 2.0 (the "License");
+**      you may not use this file except in compliance with the License.
+**      You may obtain a copy of the License at
+**
+**        http://www.apache.org/licenses/LICENSE-2.0
+**
+**      Unless required by applicable law or agreed to in writing, software
+**      distributed under the License is distributed on an "AS IS" BASIS,
+**      WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**      See the License for the specific language governing permissions and
+**      limitations under the License.
+**
+**
+** File: object_tracking_app_window.c
+**
+** Purpose:
+**   Answers "closest approach / highest confidence of this track in the last
+**   T seconds" in constant time, whatever the length of the history.
+**
+** Notes:
+**   Each extreme has a monotonic deque: a new sample first removes every
+**   sample at the back it beats, so the front is always the extreme of the
+**   window and expiring means popping the front. Every sample is pushed and
+**   popped at most once, O(1) amortized. Samples older than the newest of
+**   their track are left out.
+**
+*******************************************************************************/
+
+/*
+** Include Files:
+*/
+#include "object_tracking_app_msgids.h"
+#include "object_tracking_app_history.h"
+#include "object_tracking_app_window.h"
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  OBJECT_Deque_Push                                                  */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Appends a sample. With 'dominates' set, first drops every sample   */
+/*         at the back that can no longer be the extreme. Returns false when  */
+/*         the full deque had to drop its oldest sample.                      */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * *  * *  * * * * */
+static bool OBJECT_Deque_Push(OBJECT_Window_Deque_t *deque, uint64 key, float value,
+                              bool (*dominates)(float, float)){
+    bool kept = true;
+
+    if(dominates != NULL){
+        while((deque->tail != deque->head) &&
+              dominates(value, deque->samples[(deque->tail - 1) & OBJECT_WINDOW_MASK].value)){
+            deque->tail--;
+        }
+    }
+
+    if((deque->tail - deque->head) == OBJECT_WINDOW_SAMPLES){
+        deque->head++;
+        kept = false;
+    }
+
+    deque->samples[deque->tail & OBJECT_WINDOW_MASK].key = key;
+    deque->samples[deque->tail & OBJECT_WINDOW_MASK].value = value;
+    deque->tail++;
+
+    return(kept);
+
+} /* End of OBJECT_Deque_Push */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  OBJECT_Deque_Expire                                                */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Pops the samples older than 'cutoff' from the front                */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * *  * *  * * * * */
+static void OBJECT_Deque_Expire(OBJECT_Window_Deque_t *deque, uint64 cutoff){
+
+    while((deque->tail != deque->head) && (deque->samples[deque->head & OBJECT_WINDOW_MASK].key < cutoff)){
+        deque->head++;
+    }
+
+} /* End of OBJECT_Deque_Expire */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  OBJECT_Deque_Front                                                 */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Extreme of the window, 0 when empty                                */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * *  * *  * * * * */
+static float OBJECT_Deque_Front(const OBJECT_Window_Deque_t *deque){
+
+    return((deque->tail != deque->head) ? deque->samples[deque->head & OBJECT_WINDOW_MASK].value : 0.0f);
+
+} /* End of OBJECT_Deque_Front */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  OBJECT_Window_Lower                                                */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Minimum deque order, a new sample replaces any greater or equal one*/
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * *  * *  * * * * */
+static bool OBJECT_Window_Lower(float value, float back){
+
+    return(value <= back);
+
+} /* End of OBJECT_Window_Lower */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  OBJECT_Window_Higher                                               */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Maximum deque order, a new sample replaces any lower or equal one  */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * *  * *  * * * * */
+static bool OBJECT_Window_Higher(float value, float back){
+
+    return(value >= back);
+
+} /* End of OBJECT_Window_Higher */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  OBJECT_Window_Init                                                 */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Empties every window and initializes the aggregate packet          */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * *  * *  * * * * */
+void OBJECT_Window_Init(OBJECT_Window_t *window){
+
+    memset(window, 0, sizeof(*window));
+    window->window_ms = OBJECT_WINDOW_MS_DEFAULT;
+
+    CFE_SB_InitMsg(&window->msg,
+                   OBJECT_TRACKER_WINDOW_PUB,
+                   sizeof(window->msg),
+                   true);
+
+} /* End of OBJECT_Window_Init */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  OBJECT_Window_Update                                               */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Adds one ingested detection to its track's windows                 */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * *  * *  * * * * */
+void OBJECT_Window_Update(OBJECT_Window_t *window, uint16 track_id, const rover_state *state){
+    OBJECT_Window_Track_t *track;
+    uint64 key = OBJECT_HISTORY_TIME_KEY(state->timeStamp_sec, state->timeStamp_nanoSec);
+
+    if((track_id == 0) || (track_id > OBJECT_DICT_MAX_TRACKS)){
+        return;
+    }
+    track = &window->tracks[track_id - 1];
+
+    // Deques only take samples in time order
+    if((track->all.tail != track->all.head) &&
+       (key < track->all.samples[(track->all.tail - 1) & OBJECT_WINDOW_MASK].key)){
+        return;
+    }
+
+    track->class_id = state->class_id;
+    if((state->class_id < MAX_OBJECT_TRACKING) && (key > window->latest_key[state->class_id])){
+        window->latest_key[state->class_id] = key;
+    }
+
+    // The 'all' deque drops samples only when the window outgrows it
+    if(!OBJECT_Deque_Push(&track->all, key, 0.0f, NULL)){
+        track->saturated = true;
+    }
+    OBJECT_Deque_Push(&track->min_distance, key, (float) state->distance, OBJECT_Window_Lower);
+    OBJECT_Deque_Push(&track->max_distance, key, (float) state->distance, OBJECT_Window_Higher);
+    OBJECT_Deque_Push(&track->max_confidence, key, (float) state->confidenceScore, OBJECT_Window_Higher);
+
+} /* End of OBJECT_Window_Update */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  OBJECT_Window_Clear_Track                                          */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Forgets a deleted track, its id may be reused                      */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * *  * *  * * * * */
+void OBJECT_Window_Clear_Track(OBJECT_Window_t *window, uint16 track_id){
+
+    if((track_id != 0) && (track_id <= OBJECT_DICT_MAX_TRACKS)){
+        memset(&window->tracks[track_id - 1], 0, sizeof(OBJECT_Window_Track_t));
+    }
+
+} /* End of OBJECT_Window_Clear_Track */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  OBJECT_Window_Publish                                              */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Expires the windows and sends the aggregates of 'track_id', or     */
+/*         of every track of 'class_id' (OBJECT_PREDICT_ALL_CLASSES for all)  */
+/*         with a sample in the window. Always sends at least one packet.     */
+/*         Returns the number of tracks reported.                             */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * *  * *  * * * * */
+uint16 OBJECT_Window_Publish(OBJECT_Window_t *window, uint8 class_id, uint16 track_id){
+    OBJECT_Window_Payload_t *payload = &window->msg.Payload;
+    OBJECT_Window_Track_t *track;
+    OBJECT_Window_Entry_t *entry;
+    uint16 track_ids[OBJECT_DICT_MAX_TRACKS];
+    uint16 total = 0;
+    uint16 itr;
+    uint64 span = (uint64) window->window_ms * 1000000ULL;
+    uint64 latest = 0;
+    uint64 cutoff;
+
+    for(itr = 0; itr < MAX_OBJECT_TRACKING; itr++){
+        if(window->latest_key[itr] > latest){
+            latest = window->latest_key[itr];
+        }
+    }
+    cutoff = (latest > span) ? (latest - span) : 0;
+
+    for(itr = 1; itr <= OBJECT_DICT_MAX_TRACKS; itr++){
+        track = &window->tracks[itr - 1];
+
+        OBJECT_Deque_Expire(&track->all, cutoff);
+        OBJECT_Deque_Expire(&track->min_distance, cutoff);
+        OBJECT_Deque_Expire(&track->max_distance, cutoff);
+        OBJECT_Deque_Expire(&track->max_confidence, cutoff);
+
+        if((track->all.tail != track->all.head) &&
+           ((track_id == 0) || (track_id == itr)) &&
+           ((class_id == OBJECT_PREDICT_ALL_CLASSES) || (class_id == track->class_id))){
+            track_ids[total++] = itr;
+        }
+    }
+
+    payload->window_ms = window->window_ms;
+    payload->total_entries = total;
+
+    itr = 0;
+    do{
+        payload->first_entry = itr;
+        payload->entry_count = 0;
+
+        for(; (itr < total) && (payload->entry_count < OBJECT_WINDOW_MAX_ENTRIES); itr++){
+            track = &window->tracks[track_ids[itr] - 1];
+            entry = &payload->entries[payload->entry_count++];
+
+            entry->track_id = track_ids[itr];
+            entry->class_id = track->class_id;
+            entry->saturated = track->saturated;
+            entry->count = track->all.tail - track->all.head;
+            entry->min_distance = OBJECT_Deque_Front(&track->min_distance);
+            entry->max_distance = OBJECT_Deque_Front(&track->max_distance);
+            entry->max_confidence = OBJECT_Deque_Front(&track->max_confidence);
+        }
+
+        CFE_SB_SetTotalMsgLength((CFE_SB_MsgPtr_t) &window->msg,
+                                 sizeof(window->msg) -
+                                 ((OBJECT_WINDOW_MAX_ENTRIES - payload->entry_count) * sizeof(OBJECT_Window_Entry_t)));
+        CFE_SB_TimeStampMsg((CFE_SB_MsgPtr_t) &window->msg);
+        CFE_SB_SendMsg((CFE_SB_MsgPtr_t) &window->msg);
+    } while(itr < total);
+
+    return(total);
+
+} /* End of OBJECT_Window_Publish */
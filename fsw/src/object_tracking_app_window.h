@@ -0,0 +1,101 @@
+/*******************************************************************************
+**
+**      GSC-18128-1, "Core Flight Executive Version 6.7"
+**
+**      Copyright (c) 2006-2019 United States Government as represented by
+**      the Administrator of the National Aeronautics and Space Administration.
+**      All Rights Reserved.
+**
+**      Licensed under the Apache License, Version 2.0 (the "License");
+**      you may not use this file except in compliance with the License.
+**      You may obtain a copy of the License at
+**
+**        http://www.apache.org/licenses/LICENSE-2.0
+**
+**      Unless required by applicable law or agreed to in writing, software
+**      distributed under the License is distributed on an "AS IS" BASIS,
+**      WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**      See the License for the specific language governing permissions and
+**      limitations under the License.
+**
+**
+** File: object_tracking_app_window.h
+**
+** Purpose:
+**   Per-track sliding-window aggregates kept with monotonic deques.
+**
+*******************************************************************************/
+
+#ifndef _object_tracking_app_window_h_
+#define _object_tracking_app_window_h_
+
+#include "cfe.h"
+
+#include "object_tracking_app_msg.h"
+#include "object_tracking_app_compact.h"
+
+// Samples a track keeps per deque, a power of two
+#define OBJECT_WINDOW_SAMPLES                 256
+#define OBJECT_WINDOW_MASK                    (OBJECT_WINDOW_SAMPLES - 1)
+
+// Detection rate of one track the deques are sized for
+#define OBJECT_WINDOW_RATE_HZ                 30
+
+// Window length at startup, and the longest window the deques hold at OBJECT_WINDOW_RATE_HZ
+#define OBJECT_WINDOW_MS_DEFAULT              5000
+#define OBJECT_WINDOW_MS_MAX                  ((OBJECT_WINDOW_SAMPLES * 1000) / OBJECT_WINDOW_RATE_HZ)
+
+#if OBJECT_WINDOW_MS_DEFAULT > OBJECT_WINDOW_MS_MAX
+#error "OBJECT_WINDOW_SAMPLES can't hold the default window at OBJECT_WINDOW_RATE_HZ"
+#endif
+
+typedef struct
+{
+    // Detection timestamp, OBJECT_HISTORY_TIME_KEY
+    uint64      key;
+    float       value;
+} OBJECT_Window_Sample_t;
+
+// Ring of samples between 'head' (oldest) and 'tail'
+typedef struct
+{
+    OBJECT_Window_Sample_t  samples[OBJECT_WINDOW_SAMPLES];
+    uint32                  head;
+    uint32                  tail;
+} OBJECT_Window_Deque_t;
+
+typedef struct
+{
+    uint8                   class_id;
+
+    // Set once a sample was pushed out by a newer one before it expired
+    bool                    saturated;
+
+    // Every sample, and the candidates for each extreme
+    OBJECT_Window_Deque_t   all;
+    OBJECT_Window_Deque_t   min_distance;
+    OBJECT_Window_Deque_t   max_distance;
+    OBJECT_Window_Deque_t   max_confidence;
+} OBJECT_Window_Track_t;
+
+typedef struct
+{
+    // Indexed by track id - 1
+    OBJECT_Window_Track_t   tracks[OBJECT_DICT_MAX_TRACKS];
+
+    uint32                  window_ms;
+    bool                    publish;
+
+    // Newest detection timestamp seen per class, written by the class's
+    // shard. The window ends at the newest of them.
+    uint64                  latest_key[MAX_OBJECT_TRACKING];
+
+    OBJECT_Window_Packet_t  msg;
+} OBJECT_Window_t;
+
+void   OBJECT_Window_Init(OBJECT_Window_t *window);
+void   OBJECT_Window_Update(OBJECT_Window_t *window, uint16 track_id, const rover_state *state);
+void   OBJECT_Window_Clear_Track(OBJECT_Window_t *window, uint16 track_id);
+uint16 OBJECT_Window_Publish(OBJECT_Window_t *window, uint8 class_id, uint16 track_id);
+
+#endif /* _object_tracking_app_window_h_ */
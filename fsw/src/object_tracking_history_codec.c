@@ -0,0 +1,236 @@
+/*******************************************************************************
+**
+**      GSC-18128-1, "Core Flight Executive Version 6.7"
+**
+**      Copyright (c) 2006-2019 United States Government as represented by
+**      the Administrator of the National Aeronautics and Space Administration.
+**      All Rights Reserved.
+**
+**      Licensed under the Apache License, Version 2.0 (the "License");
+**      you may not use this file except in compliance with the License.
+**      You may obtain a copy of the License at
+**
+**        http://www.apache.org/licenses/LICENSE-2.0
+**
+**      Unless required by applicable law or agreed to in writing, software
+**      distributed under the License is distributed on an "AS IS" BASIS,
+**      WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**      See the License for the specific language governing permissions and
+**      limitations under the License.
+**
+** File: object_tracking_history_codec.c
+**
+** Purpose:
+**   Delta/varint encoder and decoder for complete history packets. See
+**   'object_tracking_history_codec.h' for the format. No cFE dependencies.
+**
+*******************************************************************************/
+
+/*
+** Include Files:
+*/
+#include <string.h>
+
+#include "object_tracking_history_codec.h"
+
+#define NSEC_PER_SEC      1000000000LL
+#define CDEG_PER_TURN     36000
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  Put_Varint / Put_Zigzag                                            */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         LEB128 varints, signed values are zigzag mapped first              */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * *  * *  * * * * */
+static size_t Put_Varint(uint8_t *out, uint64_t value){
+    size_t len = 0;
+
+    while(value >= 0x80){
+        out[len++] = (uint8_t) (value | 0x80);
+        value >>= 7;
+    }
+    out[len++] = (uint8_t) value;
+
+    return(len);
+}
+
+static size_t Put_Zigzag(uint8_t *out, int64_t value){
+    return(Put_Varint(out, ((uint64_t) value << 1) ^ (uint64_t) (value >> 63)));
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  Get_Varint / Get_Zigzag                                            */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Reads one varint, returns 0 if the buffer ends inside it           */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * *  * *  * * * * */
+static size_t Get_Varint(const uint8_t *in, size_t length, uint64_t *value){
+    size_t   len = 0;
+    unsigned shift = 0;
+
+    *value = 0;
+    while((len < length) && (shift < 64)){
+        *value |= (uint64_t) (in[len] & 0x7F) << shift;
+        if((in[len++] & 0x80) == 0){
+            return(len);
+        }
+        shift += 7;
+    }
+
+    return(0);
+}
+
+static size_t Get_Zigzag(const uint8_t *in, size_t length, int64_t *value){
+    uint64_t raw;
+    size_t   len = Get_Varint(in, length, &raw);
+
+    *value = (int64_t) (raw >> 1) ^ -(int64_t) (raw & 1);
+
+    return(len);
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  OBJECT_History_Encoder_Init                                        */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Starts a new packet, the next sample becomes its base sample       */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * *  * *  * * * * */
+void OBJECT_History_Encoder_Init(OBJECT_History_Encoder_t *encoder, uint8_t *buffer, size_t size){
+
+    encoder->buffer = buffer;
+    encoder->size = size;
+    encoder->length = 0;
+    encoder->sample_count = 0;
+    encoder->interval = 0;
+    memset(&encoder->previous, 0, sizeof(encoder->previous));
+
+} /* End of OBJECT_History_Encoder_Init */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  OBJECT_History_Encode                                              */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Appends one sample, as the base sample or as deltas                */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * *  * *  * * * * */
+int OBJECT_History_Encode(OBJECT_History_Encoder_t *encoder, const OBJECT_History_Sample_t *sample){
+    const OBJECT_History_Sample_t *prev = &encoder->previous;
+    uint8_t scratch[OBJECT_HISTORY_MAX_SAMPLE_SIZE];
+    size_t  len = 0;
+    int64_t interval = 0;
+    int32_t turn;
+
+    if(encoder->sample_count == 0){
+        len += Put_Varint(&scratch[len], sample->timeStamp_sec);
+        len += Put_Varint(&scratch[len], sample->timeStamp_nanoSec);
+        len += Put_Varint(&scratch[len], sample->track_id);
+        len += Put_Varint(&scratch[len], sample->class_id);
+        len += Put_Varint(&scratch[len], sample->confidence);
+        len += Put_Varint(&scratch[len], sample->distance_mm);
+        len += Put_Varint(&scratch[len], sample->orientation_cdeg);
+    } else {
+        interval = (((int64_t) sample->timeStamp_sec - (int64_t) prev->timeStamp_sec) * NSEC_PER_SEC) +
+                   ((int64_t) sample->timeStamp_nanoSec - (int64_t) prev->timeStamp_nanoSec);
+        len += Put_Zigzag(&scratch[len], interval - encoder->interval);
+        len += Put_Zigzag(&scratch[len], (int64_t) sample->track_id - (int64_t) prev->track_id);
+        len += Put_Zigzag(&scratch[len], (int64_t) sample->class_id - (int64_t) prev->class_id);
+        len += Put_Zigzag(&scratch[len], (int64_t) sample->confidence - (int64_t) prev->confidence);
+        len += Put_Zigzag(&scratch[len], (int64_t) sample->distance_mm - (int64_t) prev->distance_mm);
+
+        // Shortest way around, so 359.9 -> 0.1 degrees stays a small delta
+        turn = (int32_t) sample->orientation_cdeg - (int32_t) prev->orientation_cdeg;
+        if(turn >= (CDEG_PER_TURN / 2)){
+            turn -= CDEG_PER_TURN;
+        } else if(turn < -(CDEG_PER_TURN / 2)){
+            turn += CDEG_PER_TURN;
+        }
+        len += Put_Zigzag(&scratch[len], turn);
+    }
+
+    if((encoder->length + len) > encoder->size){
+        return(0);
+    }
+
+    memcpy(&encoder->buffer[encoder->length], scratch, len);
+    encoder->length += len;
+    encoder->sample_count++;
+    encoder->previous = *sample;
+    encoder->interval = interval;
+
+    return(1);
+
+} /* End of OBJECT_History_Encode */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  OBJECT_History_Decode                                              */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Rebuilds the samples of one delta encoded packet                   */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * *  * *  * * * * */
+int32_t OBJECT_History_Decode(const uint8_t *buffer, size_t length,
+                              OBJECT_History_Sample_t *samples, uint32_t max_samples){
+    OBJECT_History_Sample_t current;
+    uint64_t fields[7];
+    int64_t  deltas[6];
+    int64_t  nanoSec;
+    int64_t  interval = 0;
+    int32_t  orientation;
+    uint32_t count = 0;
+    size_t   offset = 0;
+    size_t   len;
+    int      itr;
+
+    memset(&current, 0, sizeof(current));
+
+    while((offset < length) && (count < max_samples)){
+        if(count == 0){
+            for(itr = 0; itr < 7; itr++){
+                len = Get_Varint(&buffer[offset], length - offset, &fields[itr]);
+                if(len == 0){
+                    return(-1);
+                }
+                offset += len;
+            }
+
+            current.timeStamp_sec = (uint32_t) fields[0];
+            current.timeStamp_nanoSec = (uint32_t) fields[1];
+            current.track_id = (uint16_t) fields[2];
+            current.class_id = (uint8_t) fields[3];
+            current.confidence = (uint8_t) fields[4];
+            current.distance_mm = (uint32_t) fields[5];
+            current.orientation_cdeg = (uint16_t) fields[6];
+        } else {
+            for(itr = 0; itr < 6; itr++){
+                len = Get_Zigzag(&buffer[offset], length - offset, &deltas[itr]);
+                if(len == 0){
+                    return(-1);
+                }
+                offset += len;
+            }
+
+            interval += deltas[0];
+            nanoSec = ((int64_t) current.timeStamp_sec * NSEC_PER_SEC) + current.timeStamp_nanoSec + interval;
+            current.timeStamp_sec = (uint32_t) (nanoSec / NSEC_PER_SEC);
+            current.timeStamp_nanoSec = (uint32_t) (nanoSec % NSEC_PER_SEC);
+            current.track_id = (uint16_t) (current.track_id + deltas[1]);
+            current.class_id = (uint8_t) (current.class_id + deltas[2]);
+            current.confidence = (uint8_t) (current.confidence + deltas[3]);
+            current.distance_mm = (uint32_t) (current.distance_mm + deltas[4]);
+
+            orientation = ((int32_t) current.orientation_cdeg + (int32_t) deltas[5]) % CDEG_PER_TURN;
+            if(orientation < 0){
+                orientation += CDEG_PER_TURN;
+            }
+            current.orientation_cdeg = (uint16_t) orientation;
+        }
+
+        samples[count++] = current;
+    }
+
+    return((int32_t) count);
+
+} /* End of OBJECT_History_Decode */
@@ -0,0 +1,176 @@
+/*******************************************************************************
+**
+**      GSC-18128-1, "Core Flight Executive Version 6.7"
+**
+**      Copyright (c) 2006-2019 United States Government as represented by
+**      the Administrator of the National Aeronautics and Space Administration.
+**      All Rights Reserved.
+**
+**      Licensed under the Apache License, Version 2.0 (the "License");
+**      you may not use this file except in compliance with the License.
+**      You may obtain a copy of the License at
+**
+**        http://www.apache.org/licenses/LICENSE-2.0
+**
+**      Unless required by applicable law or agreed to in writing, software
+**      distributed under the License is distributed on an "AS IS" BASIS,
+**      WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**      See the License for the specific language governing permissions and
+**      limitations under the License.
+**
+** File: object_tracking_shm_writer.c
+**
+** Purpose:
+**   Reference writer for the Object Tracking shared-memory ring. See
+**   'object_tracking_shm_ring.h' for the layout and the slot protocol.
+**
+*******************************************************************************/
+
+/*
+** Include Files:
+*/
+#include <fcntl.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "object_tracking_shm_writer.h"
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  OBJECT_ShmWriter_Open                                              */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Creates and maps the ring, then publishes a fresh header so a      */
+/*         running tracker resynchronizes to this writer                      */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * *  * *  * * * * */
+int OBJECT_ShmWriter_Open(OBJECT_ShmWriter_t *writer, const char *name){
+    uint32_t generation = 0;
+
+    writer->fd = shm_open(name, O_RDWR | O_CREAT, 0660);
+    if(writer->fd < 0){
+        return(-1);
+    }
+
+    if(ftruncate(writer->fd, OBJECT_SHM_RING_SIZE) != 0){
+        close(writer->fd);
+        return(-1);
+    }
+
+    writer->ring = mmap(NULL, OBJECT_SHM_RING_SIZE, PROT_READ | PROT_WRITE,
+                        MAP_SHARED, writer->fd, 0);
+    if(writer->ring == MAP_FAILED){
+        writer->ring = NULL;
+        close(writer->fd);
+        return(-1);
+    }
+
+    // Keeps the generation moving across writer restarts
+    if(writer->ring->header.magic == OBJECT_SHM_RING_MAGIC){
+        generation = writer->ring->header.generation + 1;
+    }
+
+    // Invalidates the header while the slots are cleared
+    OBJECT_SHM_STORE_RELEASE(&writer->ring->header.magic, 0);
+    memset(writer->ring->slots, 0, sizeof(writer->ring->slots));
+
+    writer->ring->header.version = OBJECT_SHM_RING_VERSION;
+    writer->ring->header.slot_count = OBJECT_SHM_RING_SLOTS;
+    writer->ring->header.slot_size = sizeof(OBJECT_ShmSlot_t);
+    writer->ring->header.head = 0;
+    writer->ring->header.generation = generation;
+    OBJECT_SHM_STORE_RELEASE(&writer->ring->header.magic, OBJECT_SHM_RING_MAGIC);
+
+    writer->sequence = 0;
+
+    return(0);
+
+} /* End of OBJECT_ShmWriter_Open */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  OBJECT_ShmWriter_Reserve                                           */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Marks the next slot as being written and returns its frame         */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * *  * *  * * * * */
+OBJECT_Frame_t *OBJECT_ShmWriter_Reserve(OBJECT_ShmWriter_t *writer){
+    OBJECT_ShmSlot_t *slot = &writer->ring->slots[writer->sequence & OBJECT_SHM_RING_MASK];
+
+    OBJECT_SHM_STORE_RELEASE(&slot->sequence, OBJECT_SHM_SLOT_WRITING(writer->sequence));
+
+    // The odd sequence must be visible before any frame bytes change
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+
+    return(&slot->frame);
+
+} /* End of OBJECT_ShmWriter_Reserve */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  OBJECT_ShmWriter_Commit                                            */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Commits the reserved slot and advances the ring head               */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * *  * *  * * * * */
+void OBJECT_ShmWriter_Commit(OBJECT_ShmWriter_t *writer){
+    OBJECT_ShmSlot_t *slot = &writer->ring->slots[writer->sequence & OBJECT_SHM_RING_MASK];
+
+    // Never publish more detections than the slot holds
+    if(slot->frame.detection_count > OBJECT_FRAME_MAX_DETECTIONS){
+        slot->frame.detection_count = OBJECT_FRAME_MAX_DETECTIONS;
+    }
+
+    OBJECT_SHM_STORE_RELEASE(&slot->sequence, OBJECT_SHM_SLOT_COMMITTED(writer->sequence));
+
+    writer->sequence++;
+    OBJECT_SHM_STORE_RELEASE(&writer->ring->header.head, writer->sequence);
+
+} /* End of OBJECT_ShmWriter_Commit */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  OBJECT_ShmWriter_Publish                                           */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Copies a frame into the next slot                                  */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * *  * *  * * * * */
+void OBJECT_ShmWriter_Publish(OBJECT_ShmWriter_t *writer, const OBJECT_Frame_t *frame){
+    uint32_t count = frame->detection_count;
+    OBJECT_Frame_t *slotFrame;
+
+    if(count > OBJECT_FRAME_MAX_DETECTIONS){
+        count = OBJECT_FRAME_MAX_DETECTIONS;
+    }
+
+    slotFrame = OBJECT_ShmWriter_Reserve(writer);
+
+    // Only the used part of the detection array is copied
+    memcpy(slotFrame, frame, OBJECT_FRAME_SIZE(count));
+    slotFrame->detection_count = count;
+
+    OBJECT_ShmWriter_Commit(writer);
+
+} /* End of OBJECT_ShmWriter_Publish */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  OBJECT_ShmWriter_Close                                             */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Unmaps the ring, the shared memory object is left for the reader   */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * *  * *  * * * * */
+void OBJECT_ShmWriter_Close(OBJECT_ShmWriter_t *writer){
+
+    if(writer->ring != NULL){
+        munmap(writer->ring, OBJECT_SHM_RING_SIZE);
+        writer->ring = NULL;
+    }
+
+    if(writer->fd >= 0){
+        close(writer->fd);
+        writer->fd = -1;
+    }
+
+} /* End of OBJECT_ShmWriter_Close */
@@ -0,0 +1,62 @@
+/************************************************************************
+**
+**      GSC-18128-1, "Core Flight Executive Version 6.7"
+**
+**      Copyright (c) 2006-2019 United States Government as represented by
+**      the Administrator of the National Aeronautics and Space Administration.
+**      All Rights Reserved.
+**
+**      Licensed under the Apache License, Version 2.0 (the "License");
+**      you may not use this file except in compliance with the License.
+**      You may obtain a copy of the License at
+**
+**        http://www.apache.org/licenses/LICENSE-2.0
+**
+**      Unless required by applicable law or agreed to in writing, software
+**      distributed under the License is distributed on an "AS IS" BASIS,
+**      WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**      See the License for the specific language governing permissions and
+**      limitations under the License.
+**
+** File: object_tracking_shm_writer.h
+**
+** Purpose:
+**  Writer side of the Object Tracking shared-memory ring. Linked into the
+**  ROS2 bridge in place of writing 'Output_N' JSON files.
+**
+** Notes:
+**  Frames can either be filled in place ('Reserve' + 'Commit') or copied
+**  in ('Publish').
+**
+*************************************************************************/
+#ifndef _object_tracking_shm_writer_h_
+#define _object_tracking_shm_writer_h_
+
+#include "object_tracking_shm_ring.h"
+
+typedef struct
+{
+    int                 fd;
+    OBJECT_ShmRing_t    *ring;
+
+    // Sequence number of the frame currently reserved (or next to reserve)
+    uint64_t            sequence;
+} OBJECT_ShmWriter_t;
+
+// Creates (or re-initializes) the ring, returns 0 on success and -1 on error (errno set)
+int              OBJECT_ShmWriter_Open(OBJECT_ShmWriter_t *writer, const char *name);
+
+// Returns the slot frame for the next sequence number, fill it then call 'Commit'
+OBJECT_Frame_t  *OBJECT_ShmWriter_Reserve(OBJECT_ShmWriter_t *writer);
+void             OBJECT_ShmWriter_Commit(OBJECT_ShmWriter_t *writer);
+
+// Copies a complete frame into the ring
+void             OBJECT_ShmWriter_Publish(OBJECT_ShmWriter_t *writer, const OBJECT_Frame_t *frame);
+
+void             OBJECT_ShmWriter_Close(OBJECT_ShmWriter_t *writer);
+
+#endif /* _object_tracking_shm_writer_h_ */
+
+/************************/
+/*  End of File Comment */
+/************************/
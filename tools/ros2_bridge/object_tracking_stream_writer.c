@@ -0,0 +1,99 @@
+/*******************************************************************************
+**
+**      GSC-18128-1, "Core Flight Executive Version 6.7"
+**
+**      Copyright (c) 2006-2019 United States Government as represented by
+**      the Administrator of the National Aeronautics and Space Administration.
+**      All Rights Reserved.
+**
+**      Licensed under the Apache License, Version 2.0 (the "License");
+**      you may not use this file except in compliance with the License.
+**      You may obtain a copy of the License at
+**
+**        http://www.apache.org/licenses/LICENSE-2.0
+**
+**      Unless required by applicable law or agreed to in writing, software
+**      distributed under the License is distributed on an "AS IS" BASIS,
+**      WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**      See the License for the specific language governing permissions and
+**      limitations under the License.
+**
+**
+** File: object_tracking_stream_writer.c
+**
+** Purpose:
+**   Reference writer for the Object Tracking detection stream file. See
+**   'object_tracking_stream.h' for the record layout.
+**
+*******************************************************************************/
+
+/*
+** Include Files:
+*/
+#include <fcntl.h>
+#include <sys/uio.h>
+#include <unistd.h>
+
+#include "object_tracking_stream_writer.h"
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  OBJECT_StreamWriter_Open                                           */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Opens the stream in append mode                                    */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * *  * *  * * * * */
+int OBJECT_StreamWriter_Open(OBJECT_StreamWriter_t *writer, const char *path){
+
+    writer->fd = open(path, O_WRONLY | O_CREAT | O_APPEND, 0660);
+
+    return((writer->fd < 0) ? -1 : 0);
+
+} /* End of OBJECT_StreamWriter_Open */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  OBJECT_StreamWriter_Append                                         */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Writes the record header and frame with a single call, so the      */
+/*         reader never sees a header without its frame for long              */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * *  * *  * * * * */
+int OBJECT_StreamWriter_Append(OBJECT_StreamWriter_t *writer, const OBJECT_Frame_t *frame){
+    OBJECT_Stream_Record_t record;
+    struct iovec vectors[2];
+    uint32_t count = frame->detection_count;
+    ssize_t  expected;
+
+    if(count > OBJECT_FRAME_MAX_DETECTIONS){
+        count = OBJECT_FRAME_MAX_DETECTIONS;
+    }
+
+    record.magic = OBJECT_STREAM_RECORD_MAGIC;
+    record.length = OBJECT_FRAME_SIZE(count);
+
+    vectors[0].iov_base = &record;
+    vectors[0].iov_len = sizeof(record);
+    vectors[1].iov_base = (void *) frame;
+    vectors[1].iov_len = record.length;
+    expected = sizeof(record) + record.length;
+
+    return((writev(writer->fd, vectors, 2) == expected) ? 0 : -1);
+
+} /* End of OBJECT_StreamWriter_Append */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  OBJECT_StreamWriter_Close                                          */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Closes the stream                                                  */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * *  * *  * * * * */
+void OBJECT_StreamWriter_Close(OBJECT_StreamWriter_t *writer){
+
+    if(writer->fd >= 0){
+        close(writer->fd);
+        writer->fd = -1;
+    }
+
+} /* End of OBJECT_StreamWriter_Close */
@@ -0,0 +1,51 @@
+/************************************************************************
+**
+**      GSC-18128-1, "Core Flight Executive Version 6.7"
+**
+**      Copyright (c) 2006-2019 United States Government as represented by
+**      the Administrator of the National Aeronautics and Space Administration.
+**      All Rights Reserved.
+**
+**      Licensed under the Apache License, Version 2.0 (the "License");
+**      you may not use this file except in compliance with the License.
+**      You may obtain a copy of the License at
+**
+**        http://www.apache.org/licenses/LICENSE-2.0
+**
+**      Unless required by applicable law or agreed to in writing, software
+**      distributed under the License is distributed on an "AS IS" BASIS,
+**      WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**      See the License for the specific language governing permissions and
+**      limitations under the License.
+**
+**
+** File: object_tracking_stream_writer.h
+**
+** Purpose:
+**  Writer side of the Object Tracking detection stream file. Linked into
+**  the ROS2 bridge in place of writing 'Output_N' JSON files.
+**
+*************************************************************************/
+#ifndef _object_tracking_stream_writer_h_
+#define _object_tracking_stream_writer_h_
+
+#include "object_tracking_stream.h"
+
+typedef struct
+{
+    int                 fd;
+} OBJECT_StreamWriter_t;
+
+// Opens (or creates) the stream for appending, returns 0 on success and -1 on error (errno set)
+int  OBJECT_StreamWriter_Open(OBJECT_StreamWriter_t *writer, const char *path);
+
+// Appends one record, trimmed to the frame's detection count
+int  OBJECT_StreamWriter_Append(OBJECT_StreamWriter_t *writer, const OBJECT_Frame_t *frame);
+
+void OBJECT_StreamWriter_Close(OBJECT_StreamWriter_t *writer);
+
+#endif /* _object_tracking_stream_writer_h_ */
+
+/************************/
+/*  End of File Comment */
+/************************/
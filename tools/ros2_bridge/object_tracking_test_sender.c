@@ -0,0 +1,162 @@
+/*******************************************************************************
+**
+**      GSC-18128-1, "Core Flight Executive Version 6.7"
+**
+**      Copyright (c) 2006-2019 United States Government as represented by
+**      the Administrator of the National Aeronautics and Space Administration.
+**      All Rights Reserved.
+**
+**      Licensed under the Apache License, Version 2.0 (the "License");
+**      you may not use this file except in compliance with the License.
+**      You may obtain a copy of the License at
+**
+**        http://www.apache.org/licenses/LICENSE-2.0
+**
+**      Unless required by applicable law or agreed to in writing, software
+**      distributed under the License is distributed on an "AS IS" BASIS,
+**      WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**      See the License for the specific language governing permissions and
+**      limitations under the License.
+**
+** File: object_tracking_test_sender.c
+**
+** Purpose:
+**   Local stand-in for the ROS2 node. Sends synthetic detection frames to
+**   the Object Tracking socket ingest, one frame per datagram.
+**
+**   Usage: object_tracking_test_sender [-u unix_path | -p udp_port]
+**                                      [-r rate_hz] [-n frames] [-d detections]
+**
+*******************************************************************************/
+
+/*
+** Include Files:
+*/
+#define _GNU_SOURCE
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+
+#include "object_tracking_frame.h"
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  Fill_Frame                                                         */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Builds frame 'frameNum' with objects moving on smooth paths        */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * *  * *  * * * * */
+static void Fill_Frame(OBJECT_Frame_t *frame, unsigned long frameNum, uint32_t detections){
+    struct timespec now;
+    uint32_t itr;
+    uint32_t kp;
+    double   heading;
+
+    clock_gettime(CLOCK_REALTIME, &now);
+
+    memset(frame, 0, sizeof(*frame));
+    frame->timeStamp_sec = (uint32_t) now.tv_sec;
+    frame->timeStamp_nanoSec = (uint32_t) now.tv_nsec;
+    frame->detection_count = detections;
+
+    for(itr = 0; itr < detections; itr++){
+        OBJECT_Frame_Detection_t *detection = &frame->detections[itr];
+
+        detection->class_id = (uint8_t) (itr % 10);
+        detection->confidenceScore = 0.5 + (0.4 * sin((frameNum + itr) * 0.05));
+        detection->distance = 5.0 + itr + (2.0 * sin(frameNum * 0.02));
+        detection->orientation = fmod((frameNum * 0.5) + (itr * 36.0), 360.0);
+
+        // Keypoints spread around the object's position, the last one left out as not found
+        heading = detection->orientation * (M_PI / 180.0);
+        for(kp = 0; kp + 1 < OBJECT_FRAME_KEYPOINTS; kp++){
+            detection->keypoints[kp][0] = (float) ((detection->distance * cos(heading)) + (0.05 * kp));
+            detection->keypoints[kp][1] = (float) ((detection->distance * sin(heading)) - (0.05 * kp));
+            detection->keypoints[kp][2] = (float) (0.1 * kp);
+        }
+        snprintf(detection->class_name, sizeof(detection->class_name), "class_%u", detection->class_id);
+        snprintf(detection->object_id, sizeof(detection->object_id), "obj_%u", itr % 100);
+    }
+
+} /* End of Fill_Frame */
+
+int main(int argc, char *argv[]){
+    struct sockaddr_un unixAddr;
+    struct sockaddr_in udpAddr;
+    struct sockaddr *addr;
+    socklen_t addrLen;
+    OBJECT_Frame_t frame;
+    const char *unixPath = NULL;
+    unsigned int port = 5470;
+    unsigned long frames = 0;
+    unsigned long frameNum;
+    double rate = 30.0;
+    uint32_t detections = 4;
+    int opt;
+    int fd;
+
+    while((opt = getopt(argc, argv, "u:p:r:n:d:")) != -1){
+        switch(opt){
+            case 'u': unixPath = optarg; break;
+            case 'p': port = (unsigned int) strtoul(optarg, NULL, 0); break;
+            case 'r': rate = strtod(optarg, NULL); break;
+            case 'n': frames = strtoul(optarg, NULL, 0); break;
+            case 'd': detections = (uint32_t) strtoul(optarg, NULL, 0); break;
+            default:
+                fprintf(stderr, "usage: %s [-u unix_path | -p udp_port] [-r rate_hz] [-n frames] [-d detections]\n", argv[0]);
+                return(1);
+        }
+    }
+
+    if(detections > OBJECT_FRAME_MAX_DETECTIONS){
+        detections = OBJECT_FRAME_MAX_DETECTIONS;
+    }
+
+    if(unixPath != NULL){
+        memset(&unixAddr, 0, sizeof(unixAddr));
+        unixAddr.sun_family = AF_UNIX;
+        strncpy(unixAddr.sun_path, unixPath, sizeof(unixAddr.sun_path) - 1);
+        addr = (struct sockaddr *) &unixAddr;
+        addrLen = sizeof(unixAddr);
+        fd = socket(AF_UNIX, SOCK_DGRAM, 0);
+    } else {
+        memset(&udpAddr, 0, sizeof(udpAddr));
+        udpAddr.sin_family = AF_INET;
+        udpAddr.sin_port = htons((uint16_t) port);
+        udpAddr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        addr = (struct sockaddr *) &udpAddr;
+        addrLen = sizeof(udpAddr);
+        fd = socket(AF_INET, SOCK_DGRAM, 0);
+    }
+
+    if(fd < 0){
+        perror("socket");
+        return(1);
+    }
+
+    // Runs forever when no frame count is given
+    for(frameNum = 0; (frames == 0) || (frameNum < frames); frameNum++){
+        Fill_Frame(&frame, frameNum, detections);
+
+        // Only the used detections go on the wire
+        if(sendto(fd, &frame, OBJECT_FRAME_SIZE(detections), 0, addr, addrLen) < 0){
+            perror("sendto");
+        }
+
+        if(rate > 0.0){
+            usleep((useconds_t) (1000000.0 / rate));
+        }
+    }
+
+    close(fd);
+
+    return(0);
+
+}
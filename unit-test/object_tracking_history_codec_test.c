@@ -0,0 +1,359 @@
+/*******************************************************************************
+**
+**      GSC-18128-1, "Core Flight Executive Version 6.7"
+**
+**      Copyright (c) 2006-2019 United States Government as represented by
+**      the Administrator of the National Aeronautics and Space Administration.
+**      All Rights Reserved.
+**
+**      Licensed under the Apache License, Version 2.0 (the "License");
+**      you may not use this file except in compliance with the License.
+**      You may obtain a copy of the License at
+**
+**        http://www.apache.org/licenses/LICENSE-2.0
+**
+**      Unless required by applicable law or agreed to in writing, software
+**      distributed under the License is distributed on an "AS IS" BASIS,
+**      WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**      See the License for the specific language governing permissions and
+**      limitations under the License.
+**
+** File: object_tracking_history_codec_test.c
+**
+** Purpose:
+**   Round-trip tests for the complete history codec. Encodes histories
+**   into packets, decodes every packet on its own and compares the result
+**   with the input. Covers varint length boundaries, zigzag extremes,
+**   nanosecond carry, timestamp wrap and randomized histories. Returns 0
+**   when every case passes.
+**
+*******************************************************************************/
+
+/*
+** Include Files:
+*/
+#include <stdio.h>
+#include <string.h>
+
+#include "object_tracking_history_codec.h"
+
+#define TEST_MAX_SAMPLES      512
+#define TEST_PACKET_SIZE      4096
+#define TEST_RANDOM_RUNS      2000
+
+static uint32_t TestFailures = 0;
+static uint64_t TestRandomState = 0x9E3779B97F4A7C15ULL;
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  Test_Random                                                        */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         xorshift64, fixed seed so a failure reproduces                     */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * *  * *  * * * * */
+static uint64_t Test_Random(void){
+
+    TestRandomState ^= TestRandomState << 13;
+    TestRandomState ^= TestRandomState >> 7;
+    TestRandomState ^= TestRandomState << 17;
+
+    return(TestRandomState);
+
+} /* End of Test_Random */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  Test_Sample                                                        */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Builds one sample, orientation must be below one turn              */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * *  * *  * * * * */
+static OBJECT_History_Sample_t Test_Sample(uint32_t sec, uint32_t nanoSec, uint16_t track_id, uint8_t class_id,
+                                           uint8_t confidence, uint32_t distance_mm, uint16_t orientation_cdeg){
+    OBJECT_History_Sample_t sample;
+
+    memset(&sample, 0, sizeof(sample));
+    sample.timeStamp_sec = sec;
+    sample.timeStamp_nanoSec = nanoSec;
+    sample.track_id = track_id;
+    sample.class_id = class_id;
+    sample.confidence = confidence;
+    sample.distance_mm = distance_mm;
+    sample.orientation_cdeg = orientation_cdeg;
+
+    return(sample);
+
+} /* End of Test_Sample */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  Test_Round_Trip                                                    */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Encodes 'count' samples into packets of 'packet_size' bytes,       */
+/*         decodes every packet and checks that all samples come back         */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * *  * *  * * * * */
+static void Test_Round_Trip(const char *name, const OBJECT_History_Sample_t *samples, uint32_t count,
+                            size_t packet_size){
+    OBJECT_History_Encoder_t encoder;
+    OBJECT_History_Sample_t  decoded[TEST_MAX_SAMPLES];
+    uint8_t  packet[TEST_PACKET_SIZE];
+    uint32_t next = 0;
+    uint32_t start;
+    int32_t  result;
+    uint32_t itr;
+
+    while(next < count){
+        OBJECT_History_Encoder_Init(&encoder, packet, packet_size);
+        start = next;
+        while((next < count) && OBJECT_History_Encode(&encoder, &samples[next])){
+            next++;
+        }
+
+        if(next == start){
+            printf("FAIL %s: sample %u doesn't fit an empty %zu byte packet\n", name, next, packet_size);
+            TestFailures++;
+            return;
+        }
+
+        result = OBJECT_History_Decode(packet, encoder.length, decoded, TEST_MAX_SAMPLES);
+        if(result != (int32_t) (next - start)){
+            printf("FAIL %s: packet from sample %u decoded %d of %u samples\n", name, start, result, next - start);
+            TestFailures++;
+            return;
+        }
+
+        for(itr = 0; itr < (uint32_t) result; itr++){
+            if(memcmp(&decoded[itr], &samples[start + itr], sizeof(decoded[itr])) != 0){
+                printf("FAIL %s: sample %u decoded as %u.%09u track %u class %u conf %u dist %u orient %u,"
+                       " expected %u.%09u track %u class %u conf %u dist %u orient %u\n",
+                       name, start + itr,
+                       decoded[itr].timeStamp_sec, decoded[itr].timeStamp_nanoSec, decoded[itr].track_id,
+                       decoded[itr].class_id, decoded[itr].confidence, decoded[itr].distance_mm,
+                       decoded[itr].orientation_cdeg,
+                       samples[start + itr].timeStamp_sec, samples[start + itr].timeStamp_nanoSec,
+                       samples[start + itr].track_id, samples[start + itr].class_id,
+                       samples[start + itr].confidence, samples[start + itr].distance_mm,
+                       samples[start + itr].orientation_cdeg);
+                TestFailures++;
+                return;
+            }
+        }
+    }
+
+} /* End of Test_Round_Trip */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  Test_Varint_Boundaries                                             */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Base and delta values on both sides of every varint length         */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * *  * *  * * * * */
+static void Test_Varint_Boundaries(void){
+    static const uint32_t bounds[] = { 0, 1, 63, 64, 127, 128, 8191, 8192, 16383, 16384,
+                                       (1u << 21) - 1, 1u << 21, (1u << 28) - 1, 1u << 28,
+                                       0x7FFFFFFFu, 0x80000000u, 0xFFFFFFFEu, 0xFFFFFFFFu };
+    OBJECT_History_Sample_t samples[2 * (sizeof(bounds) / sizeof(bounds[0]))];
+    uint32_t count = 0;
+    uint32_t itr;
+
+    // Each value once as a base sample on its own, then all of them as deltas
+    for(itr = 0; itr < sizeof(bounds) / sizeof(bounds[0]); itr++){
+        samples[0] = Test_Sample(bounds[itr], bounds[itr] % 1000000000u, (uint16_t) bounds[itr],
+                                 (uint8_t) bounds[itr], (uint8_t) bounds[itr], bounds[itr],
+                                 (uint16_t) (bounds[itr] % 36000u));
+        Test_Round_Trip("varint base", samples, 1, TEST_PACKET_SIZE);
+    }
+
+    for(itr = 0; itr < sizeof(bounds) / sizeof(bounds[0]); itr++){
+        samples[count++] = Test_Sample(1000, 0, 0, 0, 0, 0, 0);
+        samples[count++] = Test_Sample(1000 + (bounds[itr] >> 20), bounds[itr] % 1000000000u,
+                                       (uint16_t) bounds[itr], (uint8_t) bounds[itr], (uint8_t) bounds[itr],
+                                       bounds[itr], (uint16_t) (bounds[itr] % 36000u));
+    }
+    Test_Round_Trip("varint deltas", samples, count, TEST_PACKET_SIZE);
+
+} /* End of Test_Varint_Boundaries */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  Test_Zigzag_Extremes                                               */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Every field swinging between its smallest and largest value        */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * *  * *  * * * * */
+static void Test_Zigzag_Extremes(void){
+    OBJECT_History_Sample_t samples[8];
+
+    samples[0] = Test_Sample(0, 0, 0, 0, 0, 0, 0);
+    samples[1] = Test_Sample(0xFFFFFFFFu, 999999999u, 0xFFFF, 0xFF, 0xFF, 0xFFFFFFFFu, 35999);
+    samples[2] = Test_Sample(0, 0, 0, 0, 0, 0, 0);
+    samples[3] = Test_Sample(0xFFFFFFFFu, 999999999u, 0xFFFF, 0xFF, 0xFF, 0xFFFFFFFFu, 17999);
+    samples[4] = Test_Sample(0xFFFFFFFFu, 999999999u, 0, 0, 0, 0, 18000);
+    samples[5] = Test_Sample(0, 1, 0xFFFF, 0xFF, 0xFF, 0xFFFFFFFFu, 0);
+    samples[6] = Test_Sample(0x80000000u, 500000000u, 0x8000, 0x80, 0x80, 0x80000000u, 18000);
+    samples[7] = Test_Sample(0x7FFFFFFFu, 499999999u, 0x7FFF, 0x7F, 0x7F, 0x7FFFFFFFu, 17999);
+
+    Test_Round_Trip("zigzag extremes", samples, 8, TEST_PACKET_SIZE);
+
+    // The same history in packets just large enough for one delta sample
+    Test_Round_Trip("zigzag extremes small packets", samples, 8, OBJECT_HISTORY_MAX_SAMPLE_SIZE);
+
+} /* End of Test_Zigzag_Extremes */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  Test_Timestamps                                                    */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Nanosecond carry at a steady rate, steps backwards and the         */
+/*         seconds counter wrapping around                                    */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * *  * *  * * * * */
+static void Test_Timestamps(void){
+    OBJECT_History_Sample_t samples[64];
+    uint64_t nanoSec;
+    uint32_t itr;
+
+    // 30 Hz across several second boundaries
+    nanoSec = (1700000000ULL * 1000000000ULL) + 950000000ULL;
+    for(itr = 0; itr < 64; itr++){
+        samples[itr] = Test_Sample((uint32_t) (nanoSec / 1000000000ULL), (uint32_t) (nanoSec % 1000000000ULL),
+                                   7, 3, 200, 5000, 9000);
+        nanoSec += 33333333ULL;
+    }
+    Test_Round_Trip("nanosecond carry", samples, 64, TEST_PACKET_SIZE);
+
+    // Exactly on and one nanosecond off the second boundary
+    samples[0] = Test_Sample(10, 999999999u, 1, 1, 1, 1, 1);
+    samples[1] = Test_Sample(11, 0, 1, 1, 1, 1, 1);
+    samples[2] = Test_Sample(11, 999999999u, 1, 1, 1, 1, 1);
+    samples[3] = Test_Sample(13, 0, 1, 1, 1, 1, 1);
+    samples[4] = Test_Sample(12, 999999999u, 1, 1, 1, 1, 1);
+    samples[5] = Test_Sample(12, 999999999u, 1, 1, 1, 1, 1);
+    samples[6] = Test_Sample(5, 1, 1, 1, 1, 1, 1);
+    Test_Round_Trip("second boundary", samples, 7, TEST_PACKET_SIZE);
+
+    // Seconds counter wrapping to zero and back
+    samples[0] = Test_Sample(0xFFFFFFFEu, 900000000u, 2, 2, 2, 2, 2);
+    samples[1] = Test_Sample(0xFFFFFFFFu, 933333333u, 2, 2, 2, 2, 2);
+    samples[2] = Test_Sample(0, 966666666u, 2, 2, 2, 2, 2);
+    samples[3] = Test_Sample(1, 0, 2, 2, 2, 2, 2);
+    samples[4] = Test_Sample(0xFFFFFFFFu, 0, 2, 2, 2, 2, 2);
+    Test_Round_Trip("timestamp wrap", samples, 5, TEST_PACKET_SIZE);
+
+} /* End of Test_Timestamps */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  Test_Random_Histories                                              */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Random walks with occasional jumps, split over random packet       */
+/*         sizes                                                              */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * *  * *  * * * * */
+static void Test_Random_Histories(void){
+    OBJECT_History_Sample_t samples[TEST_MAX_SAMPLES];
+    OBJECT_History_Sample_t current;
+    uint64_t nanoSec;
+    uint32_t count;
+    uint32_t run;
+    uint32_t itr;
+    size_t   packet_size;
+    char     name[32];
+
+    for(run = 0; run < TEST_RANDOM_RUNS; run++){
+        count = 1 + (uint32_t) (Test_Random() % TEST_MAX_SAMPLES);
+        packet_size = OBJECT_HISTORY_MAX_SAMPLE_SIZE + (size_t) (Test_Random() % (TEST_PACKET_SIZE - OBJECT_HISTORY_MAX_SAMPLE_SIZE));
+        nanoSec = Test_Random() % (0x100000000ULL * 1000000000ULL);
+        current = Test_Sample(0, 0, (uint16_t) Test_Random(), (uint8_t) Test_Random(), (uint8_t) Test_Random(),
+                              (uint32_t) Test_Random(), (uint16_t) (Test_Random() % 36000));
+
+        for(itr = 0; itr < count; itr++){
+            // Mostly small steps, every field jumps anywhere now and then
+            if((Test_Random() % 16) == 0){
+                nanoSec = Test_Random() % (0x100000000ULL * 1000000000ULL);
+                current.track_id = (uint16_t) Test_Random();
+                current.class_id = (uint8_t) Test_Random();
+                current.confidence = (uint8_t) Test_Random();
+                current.distance_mm = (uint32_t) Test_Random();
+                current.orientation_cdeg = (uint16_t) (Test_Random() % 36000);
+            } else {
+                nanoSec = (nanoSec + 33333333ULL + (Test_Random() % 2000000)) % (0x100000000ULL * 1000000000ULL);
+                current.confidence = (uint8_t) (current.confidence + (Test_Random() % 5) - 2);
+                current.distance_mm = (uint32_t) (current.distance_mm + (Test_Random() % 201) - 100);
+                current.orientation_cdeg = (uint16_t) ((current.orientation_cdeg + 36000 + (Test_Random() % 401) - 200) % 36000);
+            }
+            current.timeStamp_sec = (uint32_t) (nanoSec / 1000000000ULL);
+            current.timeStamp_nanoSec = (uint32_t) (nanoSec % 1000000000ULL);
+            samples[itr] = current;
+        }
+
+        snprintf(name, sizeof(name), "random run %u", run);
+        Test_Round_Trip(name, samples, count, packet_size);
+    }
+
+} /* End of Test_Random_Histories */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  Test_Malformed                                                     */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Packets cut inside a varint are rejected, 'max_samples' caps       */
+/*         the decode                                                         */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * *  * *  * * * * */
+static void Test_Malformed(void){
+    OBJECT_History_Encoder_t encoder;
+    OBJECT_History_Sample_t  samples[4];
+    OBJECT_History_Sample_t  decoded[4];
+    uint8_t packet[TEST_PACKET_SIZE];
+    static const uint8_t unterminated[] = { 0x80, 0x80, 0x80 };
+    uint32_t itr;
+
+    for(itr = 0; itr < 4; itr++){
+        samples[itr] = Test_Sample(100 + itr, 0, 0xFFFF, 9, 255, 0xFFFFFFFFu, 35999);
+    }
+    OBJECT_History_Encoder_Init(&encoder, packet, sizeof(packet));
+    for(itr = 0; itr < 4; itr++){
+        OBJECT_History_Encode(&encoder, &samples[itr]);
+    }
+
+    if(OBJECT_History_Decode(unterminated, sizeof(unterminated), decoded, 4) != -1){
+        printf("FAIL malformed: unterminated varint accepted\n");
+        TestFailures++;
+    }
+
+    if(OBJECT_History_Decode(packet, encoder.length - 1, decoded, 4) != -1){
+        printf("FAIL malformed: truncated packet accepted\n");
+        TestFailures++;
+    }
+
+    if(OBJECT_History_Decode(packet, encoder.length, decoded, 2) != 2){
+        printf("FAIL malformed: max_samples not respected\n");
+        TestFailures++;
+    }
+
+} /* End of Test_Malformed */
+
+int main(void){
+
+    Test_Varint_Boundaries();
+    Test_Zigzag_Extremes();
+    Test_Timestamps();
+    Test_Random_Histories();
+    Test_Malformed();
+
+    if(TestFailures != 0){
+        printf("%u history codec test(s) failed\n", TestFailures);
+        return(1);
+    }
+
+    printf("History codec tests passed\n");
+    return(0);
+
+}
+
+/************************/
+/*  End of File Comment */
+/************************/